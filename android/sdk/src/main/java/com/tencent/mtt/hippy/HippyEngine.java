@@ -75,6 +75,85 @@ public abstract class HippyEngine {
   @SuppressWarnings("JavaJniMissingFunction")
   private static native void setNativeLogHandler(HippyLogAdapter handler);
 
+  @SuppressWarnings("JavaJniMissingFunction")
+  private static native void enableEnginePool(int capacity, long maxHeapSizeInBytes);
+
+  @SuppressWarnings("JavaJniMissingFunction")
+  private static native void trimEnginePool();
+
+  @SuppressWarnings("JavaJniMissingFunction")
+  private static native void setCodeCacheDelay(long delayInMs);
+
+  @SuppressWarnings("JavaJniMissingFunction")
+  private static native void setContextRecycleEnabled(boolean enabled);
+
+  @SuppressWarnings("JavaJniMissingFunction")
+  private static native void setThreadConfig(ThreadConfig config);
+
+  /**
+   * Keeps {@code capacity} JS engines warmed up in the background, engines created with
+   * {@link #create} in the default group without custom {@link V8InitParams} take one
+   * of them instead of starting their own. Call again with 0 to disable the pool.
+   *
+   * @param soLoader the loader passed to {@link EngineInitParams}, may be null
+   * @param capacity number of warm engines
+   * @param maxHeapSizeInBytes no engine is warmed up while the warm ones would use more JS
+   *                           heap than this in total, 0 for no limit
+   */
+  public static void setEnginePool(HippySoLoaderAdapter soLoader, int capacity,
+      long maxHeapSizeInBytes) {
+    LibraryLoader.loadLibraryIfNeed(soLoader);
+    enableEnginePool(capacity, maxHeapSizeInBytes);
+  }
+
+  /**
+   * Drops the warm engines, e.g. from {@code onTrimMemory}. The pool fills up again when
+   * the next engine is created.
+   */
+  public static void trimEngines() {
+    trimEnginePool();
+  }
+
+  /**
+   * Creates code caches {@code delayInMs} after a bundle ran, when the JS thread is idle,
+   * instead of right after it compiled. The cache then also holds the functions compiled
+   * lazily during the first screen, which the next launch does not compile again.
+   *
+   * @param soLoader the loader passed to {@link EngineInitParams}, may be null
+   * @param delayInMs delay after the bundle ran, negative to create caches after compiling
+   */
+  public static void setCodeCacheDelay(HippySoLoaderAdapter soLoader, long delayInMs) {
+    LibraryLoader.loadLibraryIfNeed(soLoader);
+    setCodeCacheDelay(delayInMs);
+  }
+
+  /**
+   * Sets the scheduling of the JS and worker threads of the engines created from now on, the
+   * engines of {@link #setEnginePool} included when it is called after this.
+   *
+   * @param soLoader the loader passed to {@link EngineInitParams}, may be null
+   * @param config thread scheduling, fields left at their defaults keep the inherited values
+   */
+  public static void setThreadConfig(HippySoLoaderAdapter soLoader, ThreadConfig config) {
+    LibraryLoader.loadLibraryIfNeed(soLoader);
+    setThreadConfig(config);
+  }
+
+  /**
+   * Lets an engine destroyed while other engines of its {@link EngineInitParams#groupId} are
+   * alive leave its JS context to the next engine created in the group. The context is reset to
+   * its state after bootstrap: its globals added since are deleted and its timers canceled, so
+   * the next engine skips creating and bootstrapping a context. Engines of a group should then
+   * share their global config, which bootstrap reads.
+   *
+   * @param soLoader the loader passed to {@link EngineInitParams}, may be null
+   * @param enabled whether contexts are recycled, off by default
+   */
+  public static void setContextRecycleEnabled(HippySoLoaderAdapter soLoader, boolean enabled) {
+    LibraryLoader.loadLibraryIfNeed(soLoader);
+    setContextRecycleEnabled(enabled);
+  }
+
   /**
    * @param params 创建实例需要的参数 创建一个HippyEngine实例
    */
@@ -230,6 +309,36 @@ public abstract class HippyEngine {
   public static class V8InitParams {
     public long initialHeapSize;
     public long maximumHeapSize;
+    // Startup snapshot written by the snapshot_generator tool (ENABLE_SNAPSHOT_GENERATOR) built
+    // against the same V8 and run on the same ABI, V8 aborts on any other blob. Contexts created
+    // from it skip compiling the native sources. null starts from the snapshot built into V8.
+    public byte[] snapshotBlob;
+  }
+
+  // Linux scheduling of a thread, fields left at INHERIT keep the inherited value.
+  public static class SchedulingParams {
+    public static final int INHERIT = Integer.MIN_VALUE;
+    // setpriority() nice value, -20 to 19.
+    public int nice = INHERIT;
+    // SCHED_OTHER, SCHED_FIFO, ... and the matching sched_priority.
+    public int policy = INHERIT;
+    public int priority = 0;
+    // Bit i allows CPU i, 0 keeps the inherited mask.
+    public long cpuAffinity = 0;
+  }
+
+  public static class ThreadConfig {
+    public SchedulingParams jsThread = new SchedulingParams();
+    public SchedulingParams workerThread = new SchedulingParams();
+    // Applied to the JS thread as soon as it starts, for startupBoostDurationInMs.
+    public SchedulingParams jsStartupBoost = new SchedulingParams();
+    // 0 disables the startup boost.
+    public int startupBoostDurationInMs = 0;
+    // Runs worker tasks on one pool shared by all engines, workerThread is ignored then.
+    public boolean useSharedWorkerPool = false;
+    // Runs JS in time slices on a few threads shared by all engines, jsThread and the startup
+    // boost are ignored then.
+    public boolean useSharedJsThreadPool = false;
   }
 
   // Hippy 引擎初始化时的参数设置
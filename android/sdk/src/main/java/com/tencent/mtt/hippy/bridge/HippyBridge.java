@@ -49,6 +49,8 @@ public interface HippyBridge {
     void callFunction(String action, NativeCallback callback, byte[] buffer, int offset,
             int length);
 
+    void onVsync(long frameTimeNanos, long frameIntervalNanos);
+
     long getV8RuntimeId();
 
     interface BridgeCallback {
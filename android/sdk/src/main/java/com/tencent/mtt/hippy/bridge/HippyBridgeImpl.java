@@ -255,6 +255,15 @@ public class HippyBridgeImpl implements HippyBridge, DevRemoteDebugProxy.OnRecei
         callFunction(action, mV8RuntimeId, callback, buffer, offset, length);
     }
 
+    @Override
+    public void onVsync(long frameTimeNanos, long frameIntervalNanos) {
+        if (!mInit) {
+            return;
+        }
+
+        onVsync(mV8RuntimeId, frameTimeNanos, frameIntervalNanos);
+    }
+
     @Override
     public void onDestroy(boolean isReload) {
         if (mDebugWebSocketClient != null) {
@@ -315,6 +324,8 @@ public class HippyBridgeImpl implements HippyBridge, DevRemoteDebugProxy.OnRecei
 
     public native void onResourceReady(ByteBuffer output, long runtimeId, long resId);
 
+    private native void onVsync(long runtimeId, long frameTimeNanos, long frameIntervalNanos);
+
     private native void runInJsThread(long runtimeId, Callback<Void> callback);
 
     public void callNatives(String moduleName, String moduleFunc, String callId, byte[] buffer) {
@@ -49,6 +49,10 @@ public interface HippyBridgeManager {
 
   void execCallback(Object params, BridgeTransferType transferType);
 
+  void execAnimationFrameCallback(Object params, BridgeTransferType transferType);
+
+  void onVsync(long frameTimeNanos, long frameIntervalNanos);
+
   void destroyBridge(Callback<Boolean> callback, boolean isReload);
 
   void destroy();
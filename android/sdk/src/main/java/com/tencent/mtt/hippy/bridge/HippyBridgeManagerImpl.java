@@ -66,6 +66,7 @@ public class HippyBridgeManagerImpl implements HippyBridgeManager, HippyBridge.B
     static final int MSG_CODE_CALL_FUNCTION = 12;
     static final int MSG_CODE_DESTROY_BRIDGE = 13;
     static final int MSG_CODE_RUN_SCRIPT = 14;
+    static final int MSG_CODE_ON_VSYNC = 15;
 
     static final int FUNCTION_ACTION_LOAD_INSTANCE = 1;
     static final int FUNCTION_ACTION_RESUME_INSTANCE = 2;
@@ -73,6 +74,7 @@ public class HippyBridgeManagerImpl implements HippyBridgeManager, HippyBridge.B
     static final int FUNCTION_ACTION_DESTROY_INSTANCE = 4;
     static final int FUNCTION_ACTION_CALLBACK = 5;
     static final int FUNCTION_ACTION_CALL_JSMODULE = 6;
+    static final int FUNCTION_ACTION_ANIMATION_FRAME_CALLBACK = 7;
 
     public static final long V8_RUNTIME_ID_EMPTY = -1;
 
@@ -163,6 +165,10 @@ public class HippyBridgeManagerImpl implements HippyBridgeManager, HippyBridge.B
                 action = "callJsModule";
                 break;
             }
+            case FUNCTION_ACTION_ANIMATION_FRAME_CALLBACK: {
+                action = "animationFrameCallBack";
+                break;
+            }
         }
 
         if (mCallFunctionCallback == null) {
@@ -401,6 +407,14 @@ public class HippyBridgeManagerImpl implements HippyBridgeManager, HippyBridge.B
                     handleDestroyBridge(msg);
                     return true;
                 }
+                case MSG_CODE_ON_VSYNC: {
+                    if (mIsInit) {
+                        long[] frameTimes = (long[]) msg.obj;
+                        mHippyBridge.onVsync(frameTimes[0], frameTimes[1]);
+                    }
+
+                    return true;
+                }
             }
         } catch (Throwable e) {
             reportException(e);
@@ -540,6 +554,28 @@ public class HippyBridgeManagerImpl implements HippyBridgeManager, HippyBridge.B
         mHandler.sendMessage(message);
     }
 
+    @Override
+    public void execAnimationFrameCallback(Object params, BridgeTransferType transferType) {
+        Message message = mHandler
+                .obtainMessage(MSG_CODE_CALL_FUNCTION, transferType.value(),
+                        FUNCTION_ACTION_ANIMATION_FRAME_CALLBACK,
+                        params);
+        mHandler.sendMessage(message);
+    }
+
+    @Override
+    public void onVsync(long frameTimeNanos, long frameIntervalNanos) {
+        if (!mIsInit) {
+            return;
+        }
+
+        // Goes through the same handler as the callbacks, so it reaches the JS thread after
+        // the animation frame callbacks of its frame.
+        Message message = mHandler.obtainMessage(MSG_CODE_ON_VSYNC,
+                new long[]{frameTimeNanos, frameIntervalNanos});
+        mHandler.sendMessage(message);
+    }
+
     @Override
     public void destroyBridge(Callback<Boolean> callback, boolean isReload) {
         assert (mHandler != null);
@@ -562,6 +598,7 @@ public class HippyBridgeManagerImpl implements HippyBridgeManager, HippyBridge.B
             mHandler.removeMessages(MSG_CODE_RUN_BUNDLE);
             mHandler.removeMessages(MSG_CODE_CALL_FUNCTION);
             mHandler.removeMessages(MSG_CODE_RUN_SCRIPT);
+            mHandler.removeMessages(MSG_CODE_ON_VSYNC);
         }
     }
 
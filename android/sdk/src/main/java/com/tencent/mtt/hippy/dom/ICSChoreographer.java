@@ -167,6 +167,15 @@ public final class ICSChoreographer {
     return 60;
   }
 
+  /**
+   * Gets the time between two frames.
+   *
+   * @return The frame interval in nanoseconds.
+   */
+  public long getFrameIntervalNanos() {
+    return mFrameIntervalNanos;
+  }
+
   /**
    * Gets the choreographer for the calling thread. Must be called from a thread that already has a
    * {@link android.os.Looper} associated with it.
@@ -40,6 +40,7 @@ public class PromiseImpl implements Promise {
     private final String mModuleFunc;
     private final String mCallId;
     private boolean mNeedResolveBySelf = true;
+    private boolean mIsAnimationFrameCallback = false;
     private BridgeTransferType transferType = BridgeTransferType.BRIDGE_TRANSFER_TYPE_NORMAL;
 
     public PromiseImpl(HippyEngineContext context, String moduleName, String moduleFunc,
@@ -85,6 +86,14 @@ public class PromiseImpl implements Promise {
         return mNeedResolveBySelf;
     }
 
+    /**
+     * Marks the promise of a requestAnimationFrame call, its callback runs on the JS thread
+     * at the start of the next frame instead of in the order of the task queue.
+     */
+    public void setAnimationFrameCallback(boolean isAnimationFrameCallback) {
+        mIsAnimationFrameCallback = isAnimationFrameCallback;
+    }
+
     private boolean onInterceptPromiseCallBack(Object resultObject) {
         HippyEngineMonitorAdapter adapter = mContext.getGlobalConfigs().getEngineMonitorAdapter();
         if (adapter == null) {
@@ -107,7 +116,7 @@ public class PromiseImpl implements Promise {
             jsObject.set("moduleFunc", mModuleFunc);
             jsObject.set("callId", mCallId);
             jsObject.set("params", resultObject);
-            mContext.getBridgeManager().execCallback(jsObject, transferType);
+            execCallback(jsObject);
         } else {
             HippyMap hippyMap = new HippyMap();
             hippyMap.pushInt("result", code);
@@ -115,7 +124,15 @@ public class PromiseImpl implements Promise {
             hippyMap.pushString("moduleFunc", mModuleFunc);
             hippyMap.pushString("callId", mCallId);
             hippyMap.pushObject("params", resultObject);
-            mContext.getBridgeManager().execCallback(hippyMap, transferType);
+            execCallback(hippyMap);
+        }
+    }
+
+    private void execCallback(Object params) {
+        if (mIsAnimationFrameCallback) {
+            mContext.getBridgeManager().execAnimationFrameCallback(params, transferType);
+        } else {
+            mContext.getBridgeManager().execCallback(params, transferType);
         }
     }
 }
@@ -18,14 +18,40 @@ package com.tencent.mtt.hippy.modules.nativemodules.animation;
 import com.tencent.mtt.hippy.HippyEngineContext;
 import com.tencent.mtt.hippy.annotation.HippyMethod;
 import com.tencent.mtt.hippy.annotation.HippyNativeModule;
+import com.tencent.mtt.hippy.bridge.HippyBridgeManager;
 import com.tencent.mtt.hippy.dom.HippyChoreographer;
 import com.tencent.mtt.hippy.dom.ICSChoreographer;
 import com.tencent.mtt.hippy.modules.Promise;
+import com.tencent.mtt.hippy.modules.PromiseImpl;
 import com.tencent.mtt.hippy.modules.nativemodules.HippyNativeModuleBase;
+import java.util.ArrayList;
 
 @HippyNativeModule(name = "AnimationFrameModule", thread = HippyNativeModule.Thread.MAIN)
 public class AnimationFrameModule extends HippyNativeModuleBase {
 
+  // Only touched on the main thread.
+  private final ArrayList<Promise> mPendingPromises = new ArrayList<>();
+
+  private final HippyChoreographer.FrameCallback mFrameCallback =
+      new HippyChoreographer.FrameCallback() {
+        @Override
+        public void doFrame(long frameTimeNanos) {
+          ArrayList<Promise> promises = new ArrayList<>(mPendingPromises);
+          mPendingPromises.clear();
+          for (Promise promise : promises) {
+            promise.resolve(null);
+          }
+          // The vsync follows the callbacks through the bridge thread, so the JS thread runs
+          // them as animation frame callbacks at the start of this frame.
+          HippyBridgeManager bridgeManager = mContext.getBridgeManager();
+          if (bridgeManager != null) {
+            bridgeManager.onVsync(frameTimeNanos,
+                ICSChoreographer.getInstance().getFrameIntervalNanos());
+          }
+        }
+      };
+
+
   public AnimationFrameModule(HippyEngineContext context) {
     super(context);
   }
@@ -33,14 +59,15 @@ public class AnimationFrameModule extends HippyNativeModuleBase {
   @SuppressWarnings("unused")
   @HippyMethod(name = "requestAnimationFrame")
   public void requestAnimationFrame(final Promise promise) {
-    ICSChoreographer.getInstance().postFrameCallback(new HippyChoreographer.FrameCallback() {
-      @SuppressWarnings("unused")
-      @Override
-      public void doFrame(long frameTimeNanos) {
-        if (promise != null) {
-          promise.resolve(null);
-        }
-      }
-    });
+    if (promise == null) {
+      return;
+    }
+    if (promise instanceof PromiseImpl) {
+      ((PromiseImpl) promise).setAnimationFrameCallback(true);
+    }
+    if (mPendingPromises.isEmpty()) {
+      ICSChoreographer.getInstance().postFrameCallback(mFrameCallback);
+    }
+    mPendingPromises.add(promise);
   }
 }
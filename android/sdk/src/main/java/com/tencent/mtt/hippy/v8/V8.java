@@ -84,6 +84,46 @@ public class V8 implements V8Memory {
     requestInterrupt(mV8RuntimeId, callback);
   }
 
+  // the method can be called from any thread
+  public boolean enableTaskTelemetry() {
+    return enableTaskTelemetry(mV8RuntimeId);
+  }
+
+  /**
+   * Per task source histograms of the JS and worker task runners as JSON, latency and run time
+   * are in microseconds. Returns null until {@link #enableTaskTelemetry()} is called.
+   * The method can be called from any thread.
+   */
+  public String getTaskTelemetry() {
+    return getTaskTelemetry(mV8RuntimeId);
+  }
+
+  /**
+   * Frame counts of the JS thread and the budget of the last finished frame as JSON, times are
+   * in microseconds. Frames are the vsyncs sent for requestAnimationFrame, the counts stay at 0
+   * while no animation runs. The method can be called from any thread.
+   */
+  public String getFrameStats() {
+    return getFrameStats(mV8RuntimeId);
+  }
+
+  /**
+   * Startup phases of the runtime as JSON, from platform init to the first hippyCallNatives
+   * call, with begin and end in microseconds of a monotonic clock.
+   * The method can be called from any thread.
+   */
+  public String getStartupTimeline() {
+    return getStartupTimeline(mV8RuntimeId, false);
+  }
+
+  /**
+   * Same phases as {@link #getStartupTimeline()} in the Chrome trace event format, to be opened
+   * in chrome://tracing or Perfetto. The method can be called from any thread.
+   */
+  public String getStartupTrace() {
+    return getStartupTimeline(mV8RuntimeId, true);
+  }
+
   // [memory]
   private native boolean getHeapStatistics(long runtimeId, Callback<V8HeapStatistics> callback) throws NoSuchMethodException;
 
@@ -99,4 +139,14 @@ public class V8 implements V8Memory {
 
   private native void requestInterrupt(long runtimeId, Callback<Void> callback);
 
+  // [task]
+  private native boolean enableTaskTelemetry(long runtimeId);
+
+  private native String getTaskTelemetry(long runtimeId);
+
+  private native String getFrameStats(long runtimeId);
+
+  // [startup]
+  private native String getStartupTimeline(long runtimeId, boolean isChromeTrace);
+
 }
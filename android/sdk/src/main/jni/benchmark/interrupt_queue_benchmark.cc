@@ -0,0 +1,205 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Concurrent producers on one InterruptQueue, once while the JS thread is
+// idle so that runner tasks deliver the tasks, once while it runs a long
+// script so that interrupts do. Every task must run exactly once, and the
+// coalesced wakeups must stay far below one runner task per post. Exits with
+// 1 otherwise.
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "benchmark_utils.h"
+#include "core/base/task_runner.h"
+#include "core/napi/v8/js_native_api_v8.h"
+#include "core/task/common_task.h"
+#include "v8/interrupt_queue.h"
+
+namespace {
+
+using InterruptQueue = hippy::InterruptQueue;
+using TaskRunner = hippy::base::TaskRunner;
+using hippy::benchmark::Latch;
+using hippy::benchmark::NowInNs;
+
+constexpr uint32_t kTaskCountPerProducer = 20000;
+constexpr uint32_t kProducerCounts[] = {1, 2, 4, 8};
+constexpr char kBenchmarkSource[] = "Benchmark";
+
+struct Counters {
+  std::atomic<uint64_t> run_count{0};
+  std::atomic<uint64_t> interrupt_run_count{0};
+  // Only written on the JS thread.
+  std::atomic<bool> is_script_running{false};
+};
+
+// Tasks the queue posted to the runner, whatever their source, so that
+// queues which do not label them can be compared too.
+uint64_t GetRunnerTaskCount(TaskRunner* runner) {
+  uint64_t count = 0;
+  for (const auto& snapshot : runner->GetTelemetry()->GetSnapshot()) {
+    if (snapshot.source != kBenchmarkSource) {
+      count += snapshot.latency_in_us.count;
+    }
+  }
+  return count;
+}
+
+void RunOnRunner(TaskRunner* runner, std::function<void()> func) {
+  Latch latch(1);
+  runner->PostTask([&func, &latch] {
+    func();
+    latch.CountDown();
+  }, kBenchmarkSource);
+  latch.Wait();
+}
+
+// Waits until the runner has run everything posted so far.
+void Flush(TaskRunner* runner) {
+  RunOnRunner(runner, [] {});
+}
+
+void Produce(InterruptQueue* queue, Counters* counters, Latch* latch) {
+  for (uint32_t i = 0; i < kTaskCountPerProducer; ++i) {
+    auto task = std::make_unique<CommonTask>();
+    task->func_ = [counters, latch] {
+      counters->run_count.fetch_add(1, std::memory_order_relaxed);
+      if (counters->is_script_running.load(std::memory_order_relaxed)) {
+        counters->interrupt_run_count.fetch_add(1, std::memory_order_relaxed);
+      }
+      latch->CountDown();
+    };
+    queue->PostTask(std::move(task));
+  }
+}
+
+// Runs `for (;;) {}` on the runner until TerminateExecution.
+void PostScript(TaskRunner* runner, v8::Isolate* isolate, Counters* counters, Latch* started,
+                Latch* finished) {
+  runner->PostTask([isolate, counters, started, finished] {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    v8::TryCatch try_catch(isolate);
+    v8::Local<v8::String> source =
+        v8::String::NewFromUtf8(isolate, "for (;;) {}", v8::NewStringType::kNormal)
+            .ToLocalChecked();
+    v8::Local<v8::Script> script = v8::Script::Compile(context, source).ToLocalChecked();
+    counters->is_script_running = true;
+    started->CountDown();
+    script->Run(context).IsEmpty();
+    counters->is_script_running = false;
+    isolate->CancelTerminateExecution();
+    finished->CountDown();
+  }, kBenchmarkSource);
+}
+
+bool RunBenchmark(const std::shared_ptr<TaskRunner>& runner, v8::Isolate* isolate,
+                  InterruptQueue* queue, uint32_t producer_count, bool is_script_running) {
+  uint64_t task_count = static_cast<uint64_t>(producer_count) * kTaskCountPerProducer;
+  Counters counters;
+  Latch latch(task_count);
+  Latch script_started(1);
+  Latch script_finished(1);
+  if (is_script_running) {
+    PostScript(runner.get(), isolate, &counters, &script_started, &script_finished);
+    script_started.Wait();
+  }
+  uint64_t runner_task_count = GetRunnerTaskCount(runner.get());
+
+  uint64_t begin = NowInNs();
+  std::vector<std::thread> producers;
+  for (uint32_t p = 0; p < producer_count; ++p) {
+    producers.emplace_back(Produce, queue, &counters, &latch);
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  latch.Wait();
+  uint64_t duration = NowInNs() - begin;
+
+  if (is_script_running) {
+    isolate->TerminateExecution();
+    script_finished.Wait();
+  }
+  // Runner tasks posted during the script only run after it.
+  Flush(runner.get());
+  runner_task_count = GetRunnerTaskCount(runner.get()) - runner_task_count;
+
+  uint64_t run_count = counters.run_count.load();
+  uint64_t interrupt_run_count = counters.interrupt_run_count.load();
+  printf("%-6s producers=%u  %8.1fms  ran=%llu/%llu  by interrupt=%llu  "
+         "runner tasks=%llu  posts per runner task=%.1f\n",
+         is_script_running ? "script" : "idle", producer_count,
+         hippy::benchmark::ToMs(duration), static_cast<unsigned long long>(run_count),
+         static_cast<unsigned long long>(task_count),
+         static_cast<unsigned long long>(interrupt_run_count),
+         static_cast<unsigned long long>(runner_task_count),
+         runner_task_count ? static_cast<double>(task_count) /
+                                 static_cast<double>(runner_task_count)
+                           : static_cast<double>(task_count));
+  // Without coalescing every post would add a runner task.
+  return run_count == task_count && runner_task_count < task_count;
+}
+
+}  // namespace
+
+int main() {
+  hippy::napi::V8VM::InitializePlatform();
+  auto runner = std::make_shared<TaskRunner>();
+  runner->EnableTelemetry();
+  runner->Start();
+
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  v8::Isolate::CreateParams params;
+  params.array_buffer_allocator = allocator.get();
+  // V8 takes the stack limit from the thread that creates the isolate, which
+  // must be the one that runs its scripts.
+  v8::Isolate* isolate = nullptr;
+  RunOnRunner(runner.get(), [&isolate, &params] { isolate = v8::Isolate::New(params); });
+
+  auto queue = std::make_shared<InterruptQueue>(isolate);
+  queue->SetTaskRunner(runner);
+  auto& map = InterruptQueue::GetPersistentMap();
+  map.Insert(queue->GetId(), queue);
+
+  bool is_ok = true;
+  for (bool is_script_running : {false, true}) {
+    for (uint32_t producer_count : kProducerCounts) {
+      is_ok = RunBenchmark(runner, isolate, queue.get(), producer_count, is_script_running) &&
+              is_ok;
+    }
+  }
+
+  map.Erase(queue->GetId());
+  queue = nullptr;
+  RunOnRunner(runner.get(), [isolate] { isolate->Dispose(); });
+  runner->Terminate();
+  return is_ok ? 0 : 1;
+}
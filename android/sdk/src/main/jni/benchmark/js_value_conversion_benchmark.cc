@@ -0,0 +1,99 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// V8Ctx::ToJsValueWrapper and CreateCtxValue on a bridge sized payload, an
+// array of 10k small objects with nested arrays. Exits with 1 when a round
+// trip does not give back the same value.
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.h"
+#include "core/base/js_value_wrapper.h"
+#include "core/napi/v8/js_native_api_v8.h"
+
+namespace {
+
+using CtxValue = hippy::napi::CtxValue;
+using JSValueWrapper = hippy::base::JSValueWrapper;
+using V8Ctx = hippy::napi::V8Ctx;
+using V8VM = hippy::napi::V8VM;
+using unicode_string_view = tdf::base::unicode_string_view;
+using hippy::benchmark::NowInNs;
+
+constexpr uint32_t kElementCount = 10000;
+constexpr uint32_t kRunCount = 50;
+
+std::string MakePayloadSource() {
+  return "(function () { const a = []; for (let i = 0; i < " + std::to_string(kElementCount) +
+         "; ++i) { a.push({ id: i, name: 'item' + i, visible: i % 2 === 0, width: i + 0.5,"
+         " style: { color: 'red', margin: [1, 2, 3, 4] } }); } return a; })()";
+}
+
+void PrintStats(const char* name, std::vector<uint64_t>* durations) {
+  printf("%-16s elements=%u  p50=%8.2fms  p90=%8.2fms\n", name, kElementCount,
+         hippy::benchmark::ToMs(hippy::benchmark::Percentile(durations, 50)),
+         hippy::benchmark::ToMs(hippy::benchmark::Percentile(durations, 90)));
+}
+
+}  // namespace
+
+int main() {
+  auto vm = std::make_shared<V8VM>(nullptr);
+  auto context = std::static_pointer_cast<V8Ctx>(vm->CreateContext());
+  std::string source = MakePayloadSource();
+  std::shared_ptr<CtxValue> payload =
+      context->RunScript(unicode_string_view(source.c_str(), source.length()), "payload.js");
+  if (!payload) {
+    fprintf(stderr, "payload script failed\n");
+    return 1;
+  }
+
+  std::vector<uint64_t> to_wrapper_durations;
+  std::vector<uint64_t> to_ctx_value_durations;
+  bool is_ok = true;
+  for (uint32_t i = 0; i < kRunCount; ++i) {
+    uint64_t begin = NowInNs();
+    std::shared_ptr<JSValueWrapper> wrapper = context->ToJsValueWrapper(payload);
+    to_wrapper_durations.push_back(NowInNs() - begin);
+
+    begin = NowInNs();
+    std::shared_ptr<CtxValue> value = context->CreateCtxValue(wrapper);
+    to_ctx_value_durations.push_back(NowInNs() - begin);
+
+    std::shared_ptr<JSValueWrapper> round_trip = value ? context->ToJsValueWrapper(value) : nullptr;
+    is_ok = is_ok && wrapper && round_trip && *wrapper == *round_trip &&
+            wrapper->IsArray() && wrapper->ArrayValue().size() == kElementCount;
+  }
+
+  PrintStats("ToJsValueWrapper", &to_wrapper_durations);
+  PrintStats("CreateCtxValue", &to_ctx_value_durations);
+  if (!is_ok) {
+    fprintf(stderr, "round trip mismatch\n");
+  }
+  payload = nullptr;
+  context = nullptr;
+  return is_ok ? 0 : 1;
+}
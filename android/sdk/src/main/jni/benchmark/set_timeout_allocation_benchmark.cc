@@ -0,0 +1,161 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Heap allocations made by one setTimeout call, on a scope bootstrapped like
+// an Android page. Counts operator new on the JS thread while a script calls
+// setTimeout in a loop, less the count of the same loop calling an empty JS
+// function, so that only the native call and the timer it posts are left.
+// Allocations V8 makes with its own allocator are not seen. Exits with 1 when
+// the scope has no setTimeout.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "benchmark_utils.h"
+#include "core/base/common.h"
+#include "core/engine.h"
+#include "core/scope.h"
+#include "core/task/javascript_task.h"
+
+namespace {
+
+using Ctx = hippy::napi::Ctx;
+using CtxValue = hippy::napi::CtxValue;
+using RegisterMap = hippy::base::RegisterMap;
+using hippy::benchmark::Latch;
+
+thread_local bool is_counting = false;
+std::atomic<uint64_t> allocation_count{0};
+
+constexpr uint32_t kCallCount = 100000;
+constexpr uint32_t kWarmUpCallCount = 10000;
+constexpr char kGlobalConfig[] = R"({"Platform":{"OS":"android","APILevel":0}})";
+
+struct Case {
+  const char* name;
+  // Evaluates to a function of the call count.
+  const char* source;
+};
+
+constexpr Case kBaselineCase = {
+    "empty call",
+    "(function (n) { const f = () => {}; const g = (a, b) => 0;"
+    " for (let i = 0; i < n; ++i) g(f, 100000); })"};
+constexpr Case kCases[] = {
+    {"setTimeout",
+     "(function (n) { const f = () => {};"
+     " for (let i = 0; i < n; ++i) setTimeout(f, 100000); })"},
+    {"setTimeout+clearTimeout",
+     "(function (n) { const f = () => {};"
+     " for (let i = 0; i < n; ++i) clearTimeout(setTimeout(f, 100000)); })"},
+};
+
+// Runs on the JS thread, once to warm up and once counted.
+uint64_t CountAllocations(const std::shared_ptr<Ctx>& context, const Case& test_case) {
+  std::shared_ptr<CtxValue> function = context->RunScript(test_case.source, "benchmark.js");
+  std::shared_ptr<CtxValue> warm_up_count = context->CreateNumber(kWarmUpCallCount);
+  context->CallFunction(function, 1, &warm_up_count);
+  std::shared_ptr<CtxValue> call_count = context->CreateNumber(kCallCount);
+  uint64_t begin = allocation_count.load(std::memory_order_relaxed);
+  is_counting = true;
+  context->CallFunction(function, 1, &call_count);
+  is_counting = false;
+  return allocation_count.load(std::memory_order_relaxed) - begin;
+}
+
+void RunOnJsThread(const std::shared_ptr<Engine>& engine, std::function<void()> func) {
+  Latch latch(1);
+  auto task = std::make_shared<JavaScriptTask>();
+  task->callback = [&func, &latch] {
+    func();
+    latch.CountDown();
+  };
+  engine->GetJSRunner()->PostTask(std::move(task));
+  latch.Wait();
+}
+
+}  // namespace
+
+void* operator new(size_t size) {
+  if (is_counting) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+  }
+  void* pointer = malloc(size ? size : 1);
+  if (!pointer) {
+    abort();
+  }
+  return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+  free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+  free(pointer);
+}
+
+int main() {
+  auto engine = std::make_shared<Engine>();
+  engine->AsyncInit();
+
+  Latch initialized(1);
+  auto map = std::make_unique<RegisterMap>();
+  map->insert(std::make_pair(hippy::base::kContextCreatedCBKey, [](void* data) {
+    auto scope = reinterpret_cast<ScopeWrapper*>(data)->scope_.lock();
+    std::shared_ptr<Ctx> context = scope->GetContext();
+    context->RegisterGlobalInJs();
+    context->SetGlobalJsonVar("__HIPPYNATIVEGLOBAL__", kGlobalConfig);
+  }));
+  map->insert(std::make_pair(hippy::base::KScopeInitializedCBKey,
+                             [&initialized](void*) { initialized.CountDown(); }));
+  std::shared_ptr<Scope> scope = engine->CreateScope("benchmark", std::move(map));
+  initialized.Wait();
+
+  bool is_ok = true;
+  RunOnJsThread(engine, [&scope, &is_ok] {
+    std::shared_ptr<Ctx> context = scope->GetContext();
+    if (!context->IsFunction(context->GetGlobalObjVar("setTimeout"))) {
+      fprintf(stderr, "setTimeout is missing, bootstrap failed\n");
+      is_ok = false;
+      return;
+    }
+    uint64_t baseline = CountAllocations(context, kBaselineCase);
+    printf("%-24s %8.2f allocations per call\n", kBaselineCase.name,
+           static_cast<double>(baseline) / kCallCount);
+    for (const Case& test_case : kCases) {
+      uint64_t count = CountAllocations(context, test_case);
+      double per_call = (static_cast<double>(count) - static_cast<double>(baseline)) / kCallCount;
+      printf("%-24s %8.2f allocations per call over the baseline\n", test_case.name, per_call);
+    }
+  });
+
+  // Holds JS objects, released on the JS thread.
+  RunOnJsThread(engine, [&scope] { scope = nullptr; });
+  engine->TerminateRunner();
+  return is_ok ? 0 : 1;
+}
@@ -29,6 +29,24 @@ namespace bridge {
 
 void setNativeLogHandler(JNIEnv* j_env, __unused jobject j_object, jobject j_logger);
 
+// Keeps j_capacity default group engines warm, 0 disables the pool.
+void EnableEnginePool(JNIEnv* j_env,
+                      jobject j_object,
+                      jint j_capacity,
+                      jlong j_max_heap_size_in_bytes);
+
+void TrimEnginePool(JNIEnv* j_env, jobject j_object);
+
+// Negative creates code caches right after compiling, otherwise
+// j_delay_in_ms after the bundle ran, on an idle JS thread.
+void SetCodeCacheDelay(JNIEnv* j_env, jobject j_object, jlong j_delay_in_ms);
+
+// Lets pages of an engine group hand their context to the next page.
+void SetContextRecycleEnabled(JNIEnv* j_env, jobject j_object, jboolean j_enabled);
+
+// Thread scheduling of the engines created from now on, see Engine::ThreadConfig.
+void SetThreadConfig(JNIEnv* j_env, jobject j_object, jobject j_config);
+
 jlong InitInstance(JNIEnv* j_env,
                    jobject j_object,
                    jbyteArray j_global_config,
@@ -62,5 +80,11 @@ void RunInJsThread(JNIEnv *j_env,
                    jlong j_runtime_id,
                    jobject j_callback);
 
+void OnVsync(JNIEnv* j_env,
+             jobject j_object,
+             jlong j_runtime_id,
+             jlong j_frame_time_nanos,
+             jlong j_frame_interval_nanos);
+
 }  // namespace bridge
 }  // namespace hippy
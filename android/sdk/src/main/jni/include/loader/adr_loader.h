@@ -24,7 +24,10 @@
 
 #include <android/asset_manager.h>
 
+#include <functional>
 #include <map>
+#include <memory>
+#include <string>
 
 #include "core/core.h"
 #include "jni/scoped_java_ref.h"
@@ -72,6 +75,35 @@ bool ReadAsset(const tdf::base::unicode_string_view& path,
   return false;
 }
 
+// Streams an asset to on_chunk in pieces of at most chunk_size bytes.
+inline bool ReadAssetInChunks(const tdf::base::unicode_string_view& path,
+                              AAssetManager* aasset_manager,
+                              size_t chunk_size,
+                              const std::function<void(const char* data, size_t length)>& on_chunk) {
+  tdf::base::unicode_string_view owner(""_u8s);
+  const char* asset_path = hippy::base::StringViewUtils::ToConstCharPointer(path, owner);
+  std::string file_path = std::string(asset_path);
+  if (file_path.length() > 0 && file_path[0] == '/') {
+    file_path = file_path.substr(1);
+    asset_path = file_path.c_str();
+  }
+  TDF_BASE_DLOG(INFO) << "asset_path = " << asset_path;
+
+  auto asset =
+      AAssetManager_open(aasset_manager, asset_path, AASSET_MODE_STREAMING);
+  if (!asset) {
+    TDF_BASE_DLOG(INFO) << "ReadAssetInChunks fail, file_path = " << file_path;
+    return false;
+  }
+  std::unique_ptr<char[]> buffer(new char[chunk_size]);
+  int readbytes;
+  while ((readbytes = AAsset_read(asset, buffer.get(), chunk_size)) > 0) {
+    on_chunk(buffer.get(), static_cast<size_t>(readbytes));
+  }
+  AAsset_close(asset);
+  return readbytes == 0;
+}
+
 class ADRLoader : public hippy::base::UriLoader {
  public:
   using unicode_string_view = tdf::base::unicode_string_view;
@@ -84,6 +116,9 @@ class ADRLoader : public hippy::base::UriLoader {
                                        std::function<void(u8string)> cb);
   virtual bool RequestUntrustedContent(const unicode_string_view& uri,
                                        u8string& str);
+  virtual bool RequestUntrustedContentInChunks(
+      const unicode_string_view& uri,
+      const std::function<void(const char8_t_* data, size_t length)>& on_chunk);
 
   inline void SetBridge(std::shared_ptr<JavaRef> bridge) { bridge_ = bridge; }
   inline void SetAAssetManager(AAssetManager* aasset_manager) {
@@ -104,6 +139,8 @@ class ADRLoader : public hippy::base::UriLoader {
   bool LoadByJni(const unicode_string_view& uri,
                  const std::function<void(u8string)>& cb);
 
+  static const size_t kReadChunkSize;
+
   std::shared_ptr<JavaRef> bridge_;
   AAssetManager* aasset_manager_;
   std::weak_ptr<WorkerTaskRunner> runner_;
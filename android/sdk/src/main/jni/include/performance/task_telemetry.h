@@ -0,0 +1,44 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <jni.h>
+
+namespace hippy {
+namespace bridge {
+
+// [Task] EnableTaskTelemetry, starts recording on the JS and worker runners
+jboolean EnableTaskTelemetry(JNIEnv* j_env,
+                             jobject j_object,
+                             jlong j_runtime_id);
+// [Task] GetTaskTelemetry, snapshot of both runners as JSON, null when disabled
+jstring GetTaskTelemetry(JNIEnv* j_env,
+                         jobject j_object,
+                         jlong j_runtime_id);
+// [Task] GetFrameStats, budget of the last finished frame on the JS runner as JSON
+jstring GetFrameStats(JNIEnv* j_env,
+                      jobject j_object,
+                      jlong j_runtime_id);
+
+}  // namespace bridge
+}  // namespace hippy
@@ -55,6 +55,8 @@ class InterruptQueue: public std::enable_shared_from_this<InterruptQueue> {
     task_runner_ = task_runner;
   }
 
+  // Wakeups are coalesced, however many tasks are posted in a burst at most
+  // one runner task and one interrupt are pending at any moment.
   void PostTask(std::unique_ptr<Task> task);
   void Run();
 
@@ -63,11 +65,19 @@ class InterruptQueue: public std::enable_shared_from_this<InterruptQueue> {
   }
 
  private:
+  enum PendingWakeUp : uint32_t {
+    kRunnerTaskPending = 1u << 0,
+    kInterruptPending = 1u << 1,
+  };
+
+  void OnWakeUp(PendingWakeUp wake_up);
+
   uint32_t id_;
   v8::Isolate* isolate_;
   std::queue<std::unique_ptr<Task>> task_queue_;
   std::mutex queue_mutex_;
   std::shared_ptr<TaskRunner> task_runner_;
+  std::atomic<uint32_t> pending_wake_ups_{0};
 
   static std::atomic<uint32_t> g_id;
   static PersistentObjectMap persistent_map_;
@@ -24,9 +24,8 @@
 
 #include <android/asset_manager.h>
 #include <android/asset_manager_jni.h>
-#include <sys/stat.h>
 
-#include <future>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -54,6 +53,31 @@ REGISTER_STATIC_JNI("com/tencent/mtt/hippy/HippyEngine", // NOLINT(cert-err58-cp
                     "(Lcom/tencent/mtt/hippy/adapter/HippyLogAdapter;)V",
                     setNativeLogHandler)
 
+REGISTER_STATIC_JNI("com/tencent/mtt/hippy/HippyEngine", // NOLINT(cert-err58-cpp)
+                    "enableEnginePool",
+                    "(IJ)V",
+                    EnableEnginePool)
+
+REGISTER_STATIC_JNI("com/tencent/mtt/hippy/HippyEngine", // NOLINT(cert-err58-cpp)
+                    "trimEnginePool",
+                    "()V",
+                    TrimEnginePool)
+
+REGISTER_STATIC_JNI("com/tencent/mtt/hippy/HippyEngine", // NOLINT(cert-err58-cpp)
+                    "setCodeCacheDelay",
+                    "(J)V",
+                    SetCodeCacheDelay)
+
+REGISTER_STATIC_JNI("com/tencent/mtt/hippy/HippyEngine", // NOLINT(cert-err58-cpp)
+                    "setContextRecycleEnabled",
+                    "(Z)V",
+                    SetContextRecycleEnabled)
+
+REGISTER_STATIC_JNI("com/tencent/mtt/hippy/HippyEngine", // NOLINT(cert-err58-cpp)
+                    "setThreadConfig",
+                    "(Lcom/tencent/mtt/hippy/HippyEngine$ThreadConfig;)V",
+                    SetThreadConfig)
+
 REGISTER_JNI("com/tencent/mtt/hippy/bridge/HippyBridgeImpl", // NOLINT(cert-err58-cpp)
              "initJSFramework",
              "([BZZZLcom/tencent/mtt/hippy/bridge/NativeCallback;"
@@ -81,13 +105,20 @@ REGISTER_JNI("com/tencent/mtt/hippy/bridge/HippyBridgeImpl", // NOLINT(cert-err5
              "(JLcom/tencent/mtt/hippy/common/Callback;)V",
              RunInJsThread)
 
+REGISTER_JNI("com/tencent/mtt/hippy/bridge/HippyBridgeImpl", // NOLINT(cert-err58-cpp)
+             "onVsync",
+             "(JJJ)V",
+             OnVsync)
+
 using unicode_string_view = tdf::base::unicode_string_view;
 using u8string = unicode_string_view::u8string;
+using char8_t_ = unicode_string_view::char8_t_;
 using RegisterMap = hippy::base::RegisterMap;
 using RegisterFunction = hippy::base::RegisterFunction;
 using Ctx = hippy::napi::Ctx;
 using StringViewUtils = hippy::base::StringViewUtils;
-using HippyFile = hippy::base::HippyFile;
+using CodeCacheStore = hippy::base::CodeCacheStore;
+using StartupTimeline = hippy::base::StartupTimeline;
 using V8VM = hippy::napi::V8VM;
 using V8VMInitParam = hippy::napi::V8VMInitParam;
 #ifndef V8_WITHOUT_INSPECTOR
@@ -102,11 +133,27 @@ using V8InspectorClientImpl = hippy::inspector::V8InspectorClientImpl;
 #endif
 
 constexpr char kLogTag[] = "native";
+// Per code cache directory, i.e. per code cache tag of the Java side.
+constexpr size_t kCodeCacheMaxSizeInBytes = 16 * hippy::base::MB;
+// How long a deferred code cache waits for an idle JS thread after its delay.
+constexpr uint64_t kCodeCacheIdleTimeoutInMs = 5000;
 
 static std::unordered_map<int64_t, std::pair<std::shared_ptr<Engine>, uint32_t>>
     reuse_engine_map;
 static std::mutex engine_mutex;
+// Warm engines for kDefaultEngineId pages created with the default VM init param.
+static std::shared_ptr<EnginePool> engine_pool;
 static std::mutex log_mutex;
+// Negative creates code caches right after compiling, otherwise they are
+// created this long after the bundle ran, once lazily compiled functions have
+// been compiled too.
+static std::atomic<int64_t> code_cache_delay_in_ms{-1};
+// Pages of an engine group leave their context to the next page of the group
+// instead of destroying it, see Scope::Recycle.
+static std::atomic<bool> is_context_recycle_enabled{false};
+// Applied to every engine created from now on, see HippyEngine.setThreadConfig.
+static Engine::ThreadConfig thread_config;
+static std::mutex thread_config_mutex;
 static bool is_inited = false;
 
 constexpr int64_t kDefaultEngineId = -1;
@@ -120,6 +167,130 @@ enum INIT_CB_STATE {
   SUCCESS = 0,
 };
 
+static std::shared_ptr<V8VMInitParam> CreateDefaultVMInitParam() {
+  auto param = std::make_shared<V8VMInitParam>();
+  param->initial_heap_size_in_bytes = DEFAULT_INITIAL_HEAP_SIZE_IN_BYTES;
+  param->maximum_heap_size_in_bytes = DEFAULT_MAX_HEAP_SIZE_IN_BYTES;
+  param->near_heap_limit_callback = V8VMInitParam::HeapLimitSlowGrowthStrategy;
+  return param;
+}
+
+static std::shared_ptr<Engine> CreateEngine() {
+  auto engine = std::make_shared<Engine>();
+  std::lock_guard<std::mutex> lock(thread_config_mutex);
+  engine->SetThreadConfig(thread_config);
+  return engine;
+}
+
+static Engine::SchedulingParams ToSchedulingParams(JNIEnv* j_env, jobject j_params) {
+  Engine::SchedulingParams params;
+  if (!j_params) {
+    return params;
+  }
+  jclass j_cls = j_env->GetObjectClass(j_params);
+  params.nice = j_env->GetIntField(j_params, j_env->GetFieldID(j_cls, "nice", "I"));
+  params.policy = j_env->GetIntField(j_params, j_env->GetFieldID(j_cls, "policy", "I"));
+  params.priority = j_env->GetIntField(j_params, j_env->GetFieldID(j_cls, "priority", "I"));
+  params.cpu_affinity = static_cast<uint64_t>(
+      j_env->GetLongField(j_params, j_env->GetFieldID(j_cls, "cpuAffinity", "J")));
+  j_env->DeleteLocalRef(j_cls);
+  return params;
+}
+
+static Engine::SchedulingParams GetSchedulingParamsField(JNIEnv* j_env,
+                                                         jobject j_config,
+                                                         jclass j_cls,
+                                                         const char* name) {
+  jfieldID j_field =
+      j_env->GetFieldID(j_cls, name, "Lcom/tencent/mtt/hippy/HippyEngine$SchedulingParams;");
+  jobject j_params = j_env->GetObjectField(j_config, j_field);
+  Engine::SchedulingParams params = ToSchedulingParams(j_env, j_params);
+  j_env->DeleteLocalRef(j_params);
+  return params;
+}
+
+void SetThreadConfig(JNIEnv* j_env, __unused jobject j_object, jobject j_config) {
+  Engine::ThreadConfig config;
+  if (j_config) {
+    jclass j_cls = j_env->GetObjectClass(j_config);
+    config.js_thread = GetSchedulingParamsField(j_env, j_config, j_cls, "jsThread");
+    config.worker_thread = GetSchedulingParamsField(j_env, j_config, j_cls, "workerThread");
+    config.js_startup_boost = GetSchedulingParamsField(j_env, j_config, j_cls, "jsStartupBoost");
+    jint j_duration =
+        j_env->GetIntField(j_config, j_env->GetFieldID(j_cls, "startupBoostDurationInMs", "I"));
+    config.startup_boost_duration_in_ms =
+        j_duration > 0 ? hippy::base::checked_numeric_cast<jint, uint32_t>(j_duration) : 0;
+    config.use_shared_worker_pool =
+        j_env->GetBooleanField(j_config, j_env->GetFieldID(j_cls, "useSharedWorkerPool", "Z"));
+    config.use_shared_js_thread_pool =
+        j_env->GetBooleanField(j_config, j_env->GetFieldID(j_cls, "useSharedJsThreadPool", "Z"));
+    j_env->DeleteLocalRef(j_cls);
+  }
+  TDF_BASE_DLOG(INFO) << "SetThreadConfig, js nice = " << config.js_thread.nice
+                      << ", worker nice = " << config.worker_thread.nice
+                      << ", startup_boost_duration_in_ms = "
+                      << config.startup_boost_duration_in_ms
+                      << ", use_shared_worker_pool = " << config.use_shared_worker_pool
+                      << ", use_shared_js_thread_pool = " << config.use_shared_js_thread_pool;
+  std::lock_guard<std::mutex> lock(thread_config_mutex);
+  thread_config = config;
+}
+
+void EnableEnginePool(__unused JNIEnv* j_env,
+                      __unused jobject j_object,
+                      jint j_capacity,
+                      jlong j_max_heap_size_in_bytes) {
+  TDF_BASE_DLOG(INFO) << "EnableEnginePool, capacity = " << j_capacity
+                      << ", max_heap_size_in_bytes = " << j_max_heap_size_in_bytes;
+  std::shared_ptr<EnginePool> old_pool;
+  std::shared_ptr<EnginePool> new_pool;
+  if (j_capacity > 0) {
+    EnginePool::Config config;
+    config.capacity = hippy::base::checked_numeric_cast<jint, uint32_t>(j_capacity);
+    config.max_heap_size_in_bytes = j_max_heap_size_in_bytes > 0 ?
+        hippy::base::checked_numeric_cast<jlong, size_t>(j_max_heap_size_in_bytes) : 0;
+    config.vm_init_param = CreateDefaultVMInitParam();
+    {
+      std::lock_guard<std::mutex> lock(thread_config_mutex);
+      config.thread_config = thread_config;
+    }
+    new_pool = std::make_shared<EnginePool>(config);
+  }
+  {
+    std::lock_guard<std::mutex> lock(engine_mutex);
+    old_pool = std::move(engine_pool);
+    engine_pool = new_pool;
+  }
+  // Terminating the old engines joins their threads, outside the lock.
+  old_pool = nullptr;
+  if (new_pool) {
+    new_pool->Refill();
+  }
+}
+
+void TrimEnginePool(__unused JNIEnv* j_env, __unused jobject j_object) {
+  std::shared_ptr<EnginePool> pool;
+  {
+    std::lock_guard<std::mutex> lock(engine_mutex);
+    pool = engine_pool;
+  }
+  if (pool) {
+    pool->Trim();
+  }
+}
+
+void SetCodeCacheDelay(__unused JNIEnv* j_env, __unused jobject j_object, jlong j_delay_in_ms) {
+  TDF_BASE_DLOG(INFO) << "SetCodeCacheDelay, delay_in_ms = " << j_delay_in_ms;
+  code_cache_delay_in_ms = j_delay_in_ms;
+}
+
+void SetContextRecycleEnabled(__unused JNIEnv* j_env,
+                              __unused jobject j_object,
+                              jboolean j_enabled) {
+  TDF_BASE_DLOG(INFO) << "SetContextRecycleEnabled, enabled = " << static_cast<bool>(j_enabled);
+  is_context_recycle_enabled = j_enabled;
+}
+
 void setNativeLogHandler(JNIEnv* j_env, __unused jobject j_object, jobject j_logger) {
   if (!j_logger) {
     return;
@@ -177,6 +348,65 @@ void RunScript(JNIEnv* j_env, __unused jobject, jlong j_runtime_id, jstring j_sc
   runner->PostTask(task);
 }
 
+static void SaveCodeCache(const std::shared_ptr<WorkerTaskRunner>& task_runner,
+                          const std::shared_ptr<CodeCacheStore>& code_cache_store,
+                          const std::string& key,
+                          const std::string& code_cache_name,
+                          std::string code_cache) {
+  if (code_cache.empty()) {
+    return;
+  }
+  std::unique_ptr<CommonTask> task = std::make_unique<CommonTask>();
+  task->func_ = [code_cache_store, key, code_cache_name, code_cache = std::move(code_cache)] {
+    bool save_file_ret = code_cache_store->Put(
+        key, code_cache_name, reinterpret_cast<const uint8_t*>(code_cache.c_str()),
+        code_cache.length());
+    TDF_BASE_LOG(INFO) << "code cache save_file_ret = " << save_file_ret;
+    HIPPY_USE(save_file_ret);
+  };
+  task_runner->PostTask(std::move(task));
+}
+
+// Creates the code cache on the first idle period of the JS thread after
+// delay_in_ms. Put replaces the entry written for an older bundle atomically.
+static void PostDeferredCodeCache(const std::shared_ptr<Scope>& scope,
+                                  int64_t delay_in_ms,
+                                  uint32_t deferred_script_id,
+                                  const std::shared_ptr<CodeCacheStore>& code_cache_store,
+                                  const std::string& key,
+                                  const std::string& code_cache_name) {
+  std::shared_ptr<JavaScriptTaskRunner> runner = scope->GetTaskRunner();
+  if (!runner) {
+    return;
+  }
+  std::weak_ptr<Scope> weak_scope = scope;
+  auto idle_task = std::make_shared<IdleTask>();
+  idle_task->callback = [weak_scope, deferred_script_id, code_cache_store, key,
+                         code_cache_name](const IdleTask::Deadline& deadline) {
+    std::shared_ptr<Scope> scope = weak_scope.lock();
+    if (!scope) {
+      return;
+    }
+    auto ctx = std::static_pointer_cast<hippy::napi::V8Ctx>(scope->GetContext());
+    std::string code_cache = ctx->CreateDeferredCodeCache(deferred_script_id);
+    TDF_BASE_DLOG(INFO) << "deferred code cache created, name = " << code_cache_name
+                        << ", length = " << code_cache.length()
+                        << ", did_timeout = " << deadline.did_timeout;
+    SaveCodeCache(scope->GetWorkerTaskRunner(), code_cache_store, key, code_cache_name,
+                  std::move(code_cache));
+  };
+  std::weak_ptr<JavaScriptTaskRunner> weak_runner = runner;
+  auto delayed_task = std::make_shared<JavaScriptTask>();
+  delayed_task->callback = [weak_runner, idle_task] {
+    std::shared_ptr<JavaScriptTaskRunner> runner = weak_runner.lock();
+    if (runner) {
+      runner->PostIdleTask(idle_task, kCodeCacheIdleTimeoutInMs);
+    }
+  };
+  runner->PostDelayedTask(delayed_task,
+                          hippy::base::checked_numeric_cast<int64_t, uint64_t>(delay_in_ms));
+}
+
 bool RunScriptInternal(const std::shared_ptr<Runtime>& runtime,
                        const unicode_string_view& file_name,
                        bool is_use_code_cache,
@@ -188,103 +418,95 @@ bool RunScriptInternal(const std::shared_ptr<Runtime>& runtime,
                      << ", code_cache_dir = " << code_cache_dir
                      << ", uri = " << uri
                      << ", asset_manager = " << asset_manager;
-  unicode_string_view script_content;
-  bool read_script_flag;
-  unicode_string_view code_cache_content;
-  uint64_t modify_time = 0;
-
-  std::shared_ptr<WorkerTaskRunner> task_runner;
-  unicode_string_view code_cache_path;
-  if (is_use_code_cache) {
-    if (!asset_manager) {
-      modify_time = HippyFile::GetFileModifytime(uri);
+  std::shared_ptr<WorkerTaskRunner> task_runner = runtime->GetEngine()->GetWorkerTaskRunner();
+  std::shared_ptr<hippy::base::UriLoader> loader = runtime->GetScope()->GetUriLoader();
+  auto ctx = std::static_pointer_cast<hippy::napi::V8Ctx>(runtime->GetScope()->GetContext());
+
+  StartupTimeline& timeline = runtime->GetScope()->GetStartupTimeline();
+
+  std::shared_ptr<CodeCacheStore> code_cache_store;
+  std::string code_cache_name;
+  std::string hinted_key;
+  std::shared_ptr<CodeCacheStore::Data> code_cache;
+  if (is_use_code_cache && !StringViewUtils::IsEmpty(code_cache_dir)) {
+    StartupTimeline::ScopedPhase phase(&timeline, StartupTimeline::Phase::kCodeCacheRead);
+    code_cache_store = CodeCacheStore::GetInstance(StringViewUtils::ToU8StdStr(code_cache_dir),
+                                                   V8VM::GetCodeCacheTag(),
+                                                   kCodeCacheMaxSizeInBytes);
+    runtime->GetScope()->SetCodeCacheStore(code_cache_store);
+    code_cache_name = StringViewUtils::ToU8StdStr(uri);
+    hinted_key = code_cache_store->FindKey(code_cache_name);
+    if (!hinted_key.empty()) {
+      code_cache = code_cache_store->Get(hinted_key);
     }
+  }
 
-    code_cache_path = code_cache_dir + file_name + unicode_string_view("_") +
-                      unicode_string_view(std::to_string(modify_time));
-
-    std::promise<u8string> read_file_promise;
-    std::future<u8string> read_file_future = read_file_promise.get_future();
-    std::unique_ptr<CommonTask> task = std::make_unique<CommonTask>();
-    task->func_ =
-        hippy::base::MakeCopyable([p = std::move(read_file_promise),
-                                   code_cache_path, code_cache_dir]() mutable {
-          u8string content;
-          HippyFile::ReadFile(code_cache_path, content, true);
-          if (content.empty()) {
-            TDF_BASE_DLOG(INFO) << "Read code cache failed";
-            int ret = HippyFile::RmFullPath(code_cache_dir);
-            TDF_BASE_DLOG(INFO) << "RmFullPath ret = " << ret;
-            HIPPY_USE(ret);
-          } else {
-            TDF_BASE_DLOG(INFO) << "Read code cache succ";
-          }
-          p.set_value(std::move(content));
-        });
-
-    std::shared_ptr<Engine> engine = runtime->GetEngine();
-    task_runner = engine->GetWorkerTaskRunner();
-    task_runner->PostTask(std::move(task));
+  std::shared_ptr<hippy::napi::CtxValue> ret;
+  CodeCacheStore::Hasher hasher;
+  int64_t delay_in_ms = code_cache_delay_in_ms;
+  hippy::napi::V8Ctx::CodeCacheRequest code_cache_request;
+  if (delay_in_ms >= 0) {
+    code_cache_request.timing = hippy::napi::V8Ctx::CodeCacheRequest::Timing::kAfterExecution;
+  }
+  auto code_cache_request_ptr = code_cache_store ? &code_cache_request : nullptr;
+  if (code_cache) {
+    // Consuming the code cache is cheaper than compiling, nothing to stream.
+    // The bundle is read whole to check that it is the one the cache is for.
     u8string content;
-    read_script_flag = runtime->GetScope()->GetUriLoader()
-        ->RequestUntrustedContent(uri, content);
-    if (read_script_flag) {
-      script_content = unicode_string_view(std::move(content));
+    uint64_t read_begin = hippy::base::MonotonicallyIncreasingTimeInUs();
+    bool read_script_flag = loader->RequestUntrustedContent(uri, content);
+    timeline.Record(StartupTimeline::Phase::kBundleRead, read_begin,
+                    hippy::base::MonotonicallyIncreasingTimeInUs());
+    if (!read_script_flag || content.empty()) {
+      TDF_BASE_LOG(WARNING) << "read_script_flag = " << read_script_flag
+                            << ", script content empty, uri = " << uri;
+      return false;
     }
-    code_cache_content = read_file_future.get();
+    hasher.Update(content.c_str(), content.length());
+    if (code_cache_store->MakeKey(hasher.Finish()) != hinted_key) {
+      TDF_BASE_DLOG(INFO) << "bundle changed, code cache skipped, uri = " << uri;
+      code_cache = nullptr;
+    }
+    unicode_string_view script_content(std::move(content));
+    ret = ctx->RunScriptWithCodeCache(script_content, file_name,
+                                      code_cache ? code_cache->data() : nullptr,
+                                      code_cache ? code_cache->size() : 0,
+                                      code_cache_request_ptr);
   } else {
-    u8string content;
-    read_script_flag = runtime->GetScope()->GetUriLoader()
-        ->RequestUntrustedContent(uri, content);
-    if (read_script_flag) {
-      script_content = unicode_string_view(std::move(content));
+    // The bundle is parsed and compiled on another thread while it is read
+    // here, the engine's workers stay free for loads and code cache writes.
+    auto streamer = std::make_shared<hippy::napi::V8ScriptStreamer>(ctx->isolate_);
+    streamer->StartCompileThread();
+    uint64_t read_begin = hippy::base::MonotonicallyIncreasingTimeInUs();
+    bool read_script_flag = loader->RequestUntrustedContentInChunks(
+        uri, [&streamer, &hasher](const char8_t_* data, size_t length) {
+          streamer->AddChunk(data, length);
+          hasher.Update(data, length);
+        });
+    timeline.Record(StartupTimeline::Phase::kBundleRead, read_begin,
+                    hippy::base::MonotonicallyIncreasingTimeInUs());
+    if (!read_script_flag || !streamer->GetSourceLength()) {
+      TDF_BASE_LOG(WARNING) << "read_script_flag = " << read_script_flag
+                            << ", script content empty, uri = " << uri;
+      streamer->Cancel();
+      return false;
     }
+    streamer->Finish();
+    TDF_BASE_DLOG(INFO) << "uri = " << uri
+                        << ", script length = " << streamer->GetSourceLength();
+    ret = ctx->RunStreamedScript(streamer, file_name, code_cache_request_ptr);
   }
 
-  TDF_BASE_DLOG(INFO) << "uri = " << uri
-                      << "read_script_flag = " << read_script_flag
-                      << ", script content = " << script_content;
-
-  if (!read_script_flag || StringViewUtils::IsEmpty(script_content)) {
-    TDF_BASE_LOG(WARNING) << "read_script_flag = " << read_script_flag
-                          << ", script content empty, uri = " << uri;
-    return false;
-  }
-
-  auto ret = std::static_pointer_cast<hippy::napi::V8Ctx>(
-                 runtime->GetScope()->GetContext())
-                 ->RunScript(script_content, file_name, is_use_code_cache,
-                             &code_cache_content, true);
-  if (is_use_code_cache) {
-    if (!StringViewUtils::IsEmpty(code_cache_content)) {
-      std::unique_ptr<CommonTask> task = std::make_unique<CommonTask>();
-      task->func_ = [code_cache_path, code_cache_dir, code_cache_content] {
-        int check_dir_ret = HippyFile::CheckDir(code_cache_dir, F_OK);
-        TDF_BASE_DLOG(INFO) << "check_parent_dir_ret = " << check_dir_ret;
-        if (check_dir_ret) {
-          HippyFile::CreateDir(code_cache_dir, S_IRWXU);
-        }
-
-        size_t pos =
-            StringViewUtils::FindLastOf(code_cache_path, EXTEND_LITERAL('/'));
-        unicode_string_view code_cache_parent_dir =
-            StringViewUtils::SubStr(code_cache_path, 0, pos);
-        int check_parent_dir_ret =
-            HippyFile::CheckDir(code_cache_parent_dir, F_OK);
-        TDF_BASE_DLOG(INFO)
-            << "check_parent_dir_ret = " << check_parent_dir_ret;
-        if (check_parent_dir_ret) {
-          HippyFile::CreateDir(code_cache_parent_dir, S_IRWXU);
-        }
-
-        std::string u8_code_cache_content =
-            StringViewUtils::ToU8StdStr(code_cache_content);
-        bool save_file_ret =
-            HippyFile::SaveFile(code_cache_path, u8_code_cache_content);
-        TDF_BASE_LOG(INFO) << "code cache save_file_ret = " << save_file_ret;
-        HIPPY_USE(save_file_ret);
-      };
-      task_runner->PostTask(std::move(task));
+  if (code_cache_request.is_needed) {
+    std::string key = code_cache_store->MakeKey(hasher.Finish());
+    if (code_cache_request.timing ==
+        hippy::napi::V8Ctx::CodeCacheRequest::Timing::kAfterCompile) {
+      SaveCodeCache(task_runner, code_cache_store, key, code_cache_name,
+                    std::move(code_cache_request.code_cache));
+    } else {
+      PostDeferredCodeCache(runtime->GetScope(), delay_in_ms,
+                            code_cache_request.deferred_script_id, code_cache_store, key,
+                            code_cache_name);
     }
   }
 
@@ -523,6 +745,7 @@ jlong InitInstance(JNIEnv* j_env,
       std::make_pair(hippy::base::KScopeInitializedCBKey, scope_cb));
 
   std::shared_ptr<V8VMInitParam> param;
+  bool is_default_param = false;
   do {
     if (j_vm_init_param) {
       jclass cls = j_env->GetObjectClass(j_vm_init_param);
@@ -542,6 +765,13 @@ jlong InitInstance(JNIEnv* j_env,
       param->maximum_heap_size_in_bytes =
               hippy::base::checked_numeric_cast<jlong, size_t>(maximum_heap_size_in_bytes);
       TDF_BASE_CHECK(param->initial_heap_size_in_bytes <= param->maximum_heap_size_in_bytes);
+      jfieldID blob_field = j_env->GetFieldID(cls, "snapshotBlob", "[B");
+      auto j_blob = reinterpret_cast<jbyteArray>(j_env->GetObjectField(j_vm_init_param, blob_field));
+      if (j_blob) {
+        param->snapshot_blob =
+            std::make_shared<const std::string>(JniUtils::AppendJavaByteArrayToBytes(j_env, j_blob));
+        j_env->DeleteLocalRef(j_blob);
+      }
 #ifndef V8_WITHOUT_INSPECTOR
     } else if (!runtime->IsDebug()) {
       // When V8 inspector enable the js debugger, `near_heap_limit_callback` will be overridden,
@@ -549,10 +779,8 @@ jlong InitInstance(JNIEnv* j_env,
 #else
     } else {
 #endif
-      param = std::make_shared<V8VMInitParam>();
-      param->initial_heap_size_in_bytes = DEFAULT_INITIAL_HEAP_SIZE_IN_BYTES;
-      param->maximum_heap_size_in_bytes = DEFAULT_MAX_HEAP_SIZE_IN_BYTES;
-      param->near_heap_limit_callback = V8VMInitParam::HeapLimitSlowGrowthStrategy;
+      param = CreateDefaultVMInitParam();
+      is_default_param = true;
     }
   } while (false);
 
@@ -570,7 +798,7 @@ jlong InitInstance(JNIEnv* j_env,
       v8::Isolate* isolate = v8_vm->isolate_;
       isolate->SetData(kRuntimeSlotIndex, reinterpret_cast<void*>(runtime_id));
     } else {
-      engine = std::make_shared<Engine>();
+      engine = CreateEngine();
       reuse_engine_map[group] = std::make_pair(engine, 1);
       runtime->SetEngine(engine);
       engine->AsyncInit(param, std::move(engine_cb_map));
@@ -587,16 +815,28 @@ jlong InitInstance(JNIEnv* j_env,
                           << ", use_count = " << engine.use_count();
     } else {
       TDF_BASE_DLOG(INFO) << "engine create";
-      engine = std::make_shared<Engine>();
+      engine = CreateEngine();
       runtime->SetEngine(engine);
       reuse_engine_map[group] = std::make_pair(engine, 1);
       engine->AsyncInit(param, std::move(engine_cb_map));
     }
   } else {  // kDefaultEngineId
-    TDF_BASE_DLOG(INFO) << "default create engine";
-    engine = std::make_shared<Engine>();
-    runtime->SetEngine(engine);
-    engine->AsyncInit(param, std::move(engine_cb_map));
+    std::shared_ptr<EnginePool> pool;
+    if (is_default_param) {
+      std::lock_guard<std::mutex> lock(engine_mutex);
+      pool = engine_pool;
+    }
+    engine = pool ? pool->Acquire() : nullptr;
+    if (engine) {
+      TDF_BASE_DLOG(INFO) << "default take pooled engine";
+      runtime->SetEngine(engine);
+      engine->Adopt(std::move(engine_cb_map));
+    } else {
+      TDF_BASE_DLOG(INFO) << "default create engine";
+      engine = CreateEngine();
+      runtime->SetEngine(engine);
+      engine->AsyncInit(param, std::move(engine_cb_map));
+    }
   }
   runtime->SetScope(engine->CreateScope("", std::move(scope_cb_map)));
   TDF_BASE_DLOG(INFO) << "group = " << group;
@@ -620,11 +860,25 @@ void DestroyInstance(__unused JNIEnv* j_env,
     return;
   }
 
+  auto is_reload = static_cast<bool>(j_is_reload);
+  int64_t group = runtime->GetGroupId();
+  // Only while other pages keep the group's engine alive.
+  bool is_recycle = false;
+  bool is_last_in_group = false;
+  if (group != kDebuggerEngineId && group != kDefaultEngineId) {
+    std::lock_guard<std::mutex> lock(engine_mutex);
+    auto it = reuse_engine_map.find(group);
+    if (it != reuse_engine_map.end()) {
+      is_last_in_group = std::get<uint32_t>(it->second) == 1;
+      is_recycle = is_context_recycle_enabled && !is_reload && !is_last_in_group;
+    }
+  }
+
   std::shared_ptr<JavaScriptTask> task = std::make_shared<JavaScriptTask>();
   std::shared_ptr<JavaRef> cb = std::make_shared<JavaRef>(j_env, j_callback);
-  auto is_reload = static_cast<bool>(j_is_reload);
-  task->callback = [runtime, runtime_id, cb, is_reload] {
+  task->callback = [runtime, runtime_id, cb, is_reload, is_recycle] {
     TDF_BASE_LOG(INFO) << "js destroy begin, runtime_id = " << runtime_id << ", is_reload = " << is_reload;
+    std::shared_ptr<Engine> engine = runtime->GetEngine();
 #ifndef V8_WITHOUT_INSPECTOR
     if (runtime->IsDebug()) {
         auto inspector_client = runtime->GetEngine()->GetInspectorClient();
@@ -632,18 +886,23 @@ void DestroyInstance(__unused JNIEnv* j_env,
           auto inspector_context = runtime->GetInspectorContext();
           inspector_client->DestroyInspectorContext(is_reload, inspector_context);
         }
+    } else if (is_recycle && runtime->GetScope()->Recycle()) {
+      engine->KeepRecycledScope(runtime->GetScope());
     } else {
       runtime->GetScope()->WillExit();
     }
 #else
-    runtime->GetScope()->WillExit();
+    if (is_recycle && runtime->GetScope()->Recycle()) {
+      engine->KeepRecycledScope(runtime->GetScope());
+    } else {
+      runtime->GetScope()->WillExit();
+    }
 #endif
     TDF_BASE_LOG(INFO) << "erase runtime";
     Runtime::Erase(runtime);
     TDF_BASE_LOG(INFO) << "js destroy end";
     hippy::bridge::CallJavaMethod(cb->GetObj(), INIT_CB_STATE::SUCCESS);
   };
-  int64_t group = runtime->GetGroupId();
   if (group == kDebuggerEngineId) {
     runtime->GetScope()->WillExit();
   }
@@ -694,6 +953,26 @@ void RunInJsThread(JNIEnv *j_env,
   task_runner->PostTask(std::move(task));
 }
 
+void OnVsync(__unused JNIEnv* j_env,
+             __unused jobject j_object,
+             jlong j_runtime_id,
+             jlong j_frame_time_nanos,
+             jlong j_frame_interval_nanos) {
+  auto runtime = Runtime::Find(hippy::base::checked_numeric_cast<jlong, int32_t>(j_runtime_id));
+  if (!runtime) {
+    TDF_BASE_DLOG(WARNING) << "HippyBridgeImpl OnVsync, j_runtime_id invalid";
+    return;
+  }
+  // The frame time comes from System.nanoTime, the same CLOCK_MONOTONIC as
+  // the steady_clock the runner measures with.
+  constexpr jlong kNanosPerMs = 1000 * 1000;
+  auto frame_time = hippy::base::checked_numeric_cast<jlong, uint64_t>(
+      j_frame_time_nanos / kNanosPerMs);
+  auto frame_interval = hippy::base::checked_numeric_cast<jlong, uint64_t>(
+      j_frame_interval_nanos / kNanosPerMs);
+  runtime->GetEngine()->GetJSRunner()->OnVsync(frame_time, frame_interval);
+}
+
 }  // namespace bridge
 }  // namespace hippy
 
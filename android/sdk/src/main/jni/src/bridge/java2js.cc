@@ -58,6 +58,10 @@ using CtxValue = hippy::napi::CtxValue;
 using StringViewUtils = hippy::base::StringViewUtils;
 
 const char kHippyBridgeName[] = "hippyBridge";
+// Sent by the host for the promise of a requestAnimationFrame call, the JS side
+// sees it as a "callBack".
+const char16_t kAnimationFrameCallBackAction[] = u"animationFrameCallBack";
+const char16_t kCallBackAction[] = u"callBack";
 
 void CallFunction(JNIEnv* j_env,
                   __unused jobject j_obj,
@@ -78,11 +82,16 @@ void CallFunction(JNIEnv* j_env,
     return;
   }
   unicode_string_view action_name = JniUtils::ToStrView(j_env, j_action);
+  TDF_BASE_DCHECK(action_name.encoding() ==
+                  unicode_string_view::Encoding::Utf16);
+  bool is_animation_frame_callback = action_name.utf16_value() == kAnimationFrameCallBackAction;
+  if (is_animation_frame_callback) {
+    action_name = unicode_string_view(kCallBackAction);
+  }
   std::shared_ptr<JavaRef> cb = std::make_shared<JavaRef>(j_env, j_callback);
-  std::shared_ptr<JavaScriptTask> task = std::make_shared<JavaScriptTask>();
-  task->callback = [runtime, cb_ = std::move(cb), action_name,
-                    buffer_data_ = std::move(buffer_data),
-                    buffer_owner_ = std::move(buffer_owner)] {
+  auto call = [runtime, cb_ = std::move(cb), action_name = std::move(action_name),
+               buffer_data_ = std::move(buffer_data),
+               buffer_owner_ = std::move(buffer_owner)] {
     JNIEnv* j_env = JNIEnvironment::GetInstance()->AttachCurrentThread();
     std::shared_ptr<Scope> scope = runtime->GetScope();
     if (!scope) {
@@ -108,8 +117,6 @@ void CallFunction(JNIEnv* j_env,
         runtime->SetBridgeFunc(fn);
       }
     }
-    TDF_BASE_DCHECK(action_name.encoding() ==
-                    unicode_string_view::Encoding::Utf16);
     if (runtime->IsDebug() &&
         action_name.utf16_value() == u"onWebsocketMsg") {
 #ifndef V8_WITHOUT_INSPECTOR
@@ -173,8 +180,16 @@ void CallFunction(JNIEnv* j_env,
 
     CallJavaMethod(cb_->GetObj(), CALLFUNCTION_CB_STATE::SUCCESS);
   };
-
-  runner->PostTask(task);
+  if (is_animation_frame_callback) {
+    // Runs at the start of the frame of the vsync the host sends right after.
+    auto task = std::make_shared<JavaScriptTask>();
+    task->callback = std::move(call);
+    runner->RequestAnimationFrame(std::move(task));
+    return;
+  }
+  // Posted as an InlineClosure, the captures fit inline so the task comes
+  // from the pool instead of a std::function and a task allocation per call.
+  runner->PostTask(std::move(call), "CallFunction");
 }
 
 void CallFunctionByHeapBuffer(JNIEnv* j_env,
@@ -45,6 +45,8 @@ void CallJava(hippy::napi::CBDataTuple *data) {
   if (!runtime) {
     return;
   }
+  runtime->GetScope()->GetStartupTimeline().Mark(
+      hippy::base::StartupTimeline::Phase::kFirstCallNatives);
 
   const v8::FunctionCallbackInfo<v8::Value> &info = data->info_;
   v8::Isolate *isolate = info.GetIsolate();
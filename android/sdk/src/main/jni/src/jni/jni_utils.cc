@@ -56,7 +56,7 @@ JniUtils::bytes JniUtils::AppendJavaByteArrayToBytes(JNIEnv* j_env,
   }
 
   bytes ret;
-  ret.resize(hippy::base::checked_numeric_cast<jsize, size_t>(j_length));
+  ret.resize(hippy::base::checked_numeric_cast<jsize, size_t>(j_len));
   j_env->GetByteArrayRegion(j_byte_array, j_offset, j_len,
                             reinterpret_cast<int8_t*>(&ret[0]));
   return ret;
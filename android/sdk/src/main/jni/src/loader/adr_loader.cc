@@ -38,6 +38,8 @@ using char8_t_ = unicode_string_view::char8_t_;
 
 static std::atomic<int64_t> global_request_id{0};
 
+const size_t ADRLoader::kReadChunkSize = 64 * 1024;
+
 ADRLoader::ADRLoader() : aasset_manager_(nullptr) {}
 
 bool ADRLoader::RequestUntrustedContent(const unicode_string_view& uri,
@@ -121,6 +123,34 @@ bool ADRLoader::RequestUntrustedContent(const unicode_string_view& uri,
   }
 }
 
+bool ADRLoader::RequestUntrustedContentInChunks(
+    const unicode_string_view& uri,
+    const std::function<void(const char8_t_* data, size_t length)>& on_chunk) {
+  std::shared_ptr<Uri> uri_obj = Uri::Create(uri);
+  if (!uri_obj) {
+    TDF_BASE_DLOG(ERROR) << "uri error, uri = " << uri;
+    return false;
+  }
+  unicode_string_view schema = uri_obj->GetScheme();
+  unicode_string_view path = uri_obj->GetPath();
+  if (StringViewUtils::IsEmpty(schema) || StringViewUtils::IsEmpty(path)) {
+    TDF_BASE_DLOG(ERROR) << "schema or path error, uri = " << uri;
+    return false;
+  }
+  TDF_BASE_DCHECK(schema.encoding() == unicode_string_view::Encoding::Utf16);
+  std::u16string schema_str = schema.utf16_value();
+  auto on_char_chunk = [&on_chunk](const char* data, size_t length) {
+    on_chunk(reinterpret_cast<const char8_t_*>(data), length);
+  };
+  if (schema_str == u"file") {
+    return HippyFile::ReadFileInChunks(path, kReadChunkSize, on_char_chunk);
+  } else if (schema_str == u"asset" && aasset_manager_) {
+    return ReadAssetInChunks(path, aasset_manager_, kReadChunkSize, on_char_chunk);
+  }
+  // Network resources arrive from Java in one piece.
+  return UriLoader::RequestUntrustedContentInChunks(uri, on_chunk);
+}
+
 bool ADRLoader::LoadByFile(const unicode_string_view& path,
                            const std::function<void(u8string)>& cb) {
   std::shared_ptr<WorkerTaskRunner> runner = runner_.lock();
@@ -0,0 +1,76 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "performance/startup_timeline.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bridge/runtime.h"
+#include "core/core.h"
+#include "jni/jni_register.h"
+
+namespace hippy {
+namespace bridge {
+
+REGISTER_JNI("com/tencent/mtt/hippy/v8/V8", // NOLINT(cert-err58-cpp)
+             "getStartupTimeline",
+             "(JZ)Ljava/lang/String;",
+             GetStartupTimeline)
+
+using StartupTimeline = hippy::base::StartupTimeline;
+
+jstring GetStartupTimeline(JNIEnv* j_env,
+                           __unused jobject j_object,
+                           jlong j_runtime_id,
+                           jboolean j_is_chrome_trace) {
+  auto runtime = Runtime::Find(hippy::base::checked_numeric_cast<jlong, int32_t>(j_runtime_id));
+  if (!runtime || !runtime->GetScope()) {
+    TDF_BASE_DLOG(WARNING) << "GetStartupTimeline, j_runtime_id invalid";
+    return nullptr;
+  }
+  const StartupTimeline& timeline = runtime->GetScope()->GetStartupTimeline();
+  std::string json;
+  if (j_is_chrome_trace) {
+    json = timeline.ToChromeTraceJson();
+  } else {
+    std::vector<StartupTimeline::Event> events = timeline.GetEvents();
+    std::ostringstream stream;
+    stream << "[";
+    for (size_t i = 0; i < events.size(); ++i) {
+      const auto& event = events[i];
+      if (i) {
+        stream << ",";
+      }
+      stream << "{\"phase\":\"" << StartupTimeline::GetPhaseName(event.phase)
+             << "\",\"begin\":" << event.begin_in_us
+             << ",\"end\":" << event.end_in_us << "}";
+    }
+    stream << "]";
+    json = stream.str();
+  }
+  return j_env->NewStringUTF(json.c_str());
+}
+
+}  // namespace bridge
+}  // namespace hippy
@@ -0,0 +1,159 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "performance/task_telemetry.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bridge/runtime.h"
+#include "core/core.h"
+#include "jni/jni_register.h"
+
+namespace hippy {
+namespace bridge {
+
+REGISTER_JNI("com/tencent/mtt/hippy/v8/V8", // NOLINT(cert-err58-cpp)
+             "enableTaskTelemetry",
+             "(J)Z",
+             EnableTaskTelemetry)
+REGISTER_JNI("com/tencent/mtt/hippy/v8/V8", // NOLINT(cert-err58-cpp)
+             "getTaskTelemetry",
+             "(J)Ljava/lang/String;",
+             GetTaskTelemetry)
+REGISTER_JNI("com/tencent/mtt/hippy/v8/V8", // NOLINT(cert-err58-cpp)
+             "getFrameStats",
+             "(J)Ljava/lang/String;",
+             GetFrameStats)
+
+using Histogram = hippy::base::Histogram;
+using TaskTelemetry = hippy::base::TaskTelemetry;
+
+namespace {
+
+void WriteHistogram(std::ostringstream& stream, const Histogram::Snapshot& snapshot) {
+  stream << "{\"count\":" << snapshot.count
+         << ",\"sum\":" << snapshot.sum
+         << ",\"max\":" << snapshot.max
+         << ",\"p50\":" << snapshot.Percentile(50)
+         << ",\"p90\":" << snapshot.Percentile(90)
+         << ",\"p99\":" << snapshot.Percentile(99) << "}";
+}
+
+void WriteTelemetry(std::ostringstream& stream, const TaskTelemetry* telemetry) {
+  stream << "[";
+  if (telemetry) {
+    std::vector<TaskTelemetry::SourceSnapshot> snapshots = telemetry->GetSnapshot();
+    for (size_t i = 0; i < snapshots.size(); ++i) {
+      const auto& snapshot = snapshots[i];
+      if (i) {
+        stream << ",";
+      }
+      // Sources are plain identifiers chosen in native code, no escaping.
+      stream << "{\"source\":\"" << snapshot.source << "\",\"latency\":";
+      WriteHistogram(stream, snapshot.latency_in_us);
+      stream << ",\"runTime\":";
+      WriteHistogram(stream, snapshot.run_time_in_us);
+      stream << ",\"queueDepth\":";
+      WriteHistogram(stream, snapshot.queue_depth);
+      stream << "}";
+    }
+  }
+  stream << "]";
+}
+
+}  // namespace
+
+jboolean EnableTaskTelemetry(__unused JNIEnv* j_env,
+                             __unused jobject j_object,
+                             jlong j_runtime_id) {
+  auto runtime = Runtime::Find(hippy::base::checked_numeric_cast<jlong, int32_t>(j_runtime_id));
+  if (!runtime) {
+    TDF_BASE_DLOG(WARNING) << "EnableTaskTelemetry, j_runtime_id invalid";
+    return JNI_FALSE;
+  }
+  std::shared_ptr<Engine> engine = runtime->GetEngine();
+  std::shared_ptr<JavaScriptTaskRunner> js_runner = engine->GetJSRunner();
+  if (js_runner) {
+    js_runner->EnableTelemetry();
+  }
+  std::shared_ptr<WorkerTaskRunner> worker_runner = engine->GetWorkerTaskRunner();
+  if (worker_runner) {
+    worker_runner->EnableTelemetry();
+  }
+  return JNI_TRUE;
+}
+
+jstring GetTaskTelemetry(JNIEnv* j_env,
+                         __unused jobject j_object,
+                         jlong j_runtime_id) {
+  auto runtime = Runtime::Find(hippy::base::checked_numeric_cast<jlong, int32_t>(j_runtime_id));
+  if (!runtime) {
+    TDF_BASE_DLOG(WARNING) << "GetTaskTelemetry, j_runtime_id invalid";
+    return nullptr;
+  }
+  std::shared_ptr<Engine> engine = runtime->GetEngine();
+  std::shared_ptr<JavaScriptTaskRunner> js_runner = engine->GetJSRunner();
+  std::shared_ptr<WorkerTaskRunner> worker_runner = engine->GetWorkerTaskRunner();
+  TaskTelemetry* js_telemetry = js_runner ? js_runner->GetTelemetry() : nullptr;
+  TaskTelemetry* worker_telemetry = worker_runner ? worker_runner->GetTelemetry() : nullptr;
+  if (!js_telemetry && !worker_telemetry) {
+    return nullptr;
+  }
+
+  std::ostringstream stream;
+  stream << "{\"js\":";
+  WriteTelemetry(stream, js_telemetry);
+  stream << ",\"worker\":";
+  WriteTelemetry(stream, worker_telemetry);
+  stream << "}";
+  std::string json = stream.str();
+  return j_env->NewStringUTF(json.c_str());
+}
+
+jstring GetFrameStats(JNIEnv* j_env,
+                      __unused jobject j_object,
+                      jlong j_runtime_id) {
+  auto runtime = Runtime::Find(hippy::base::checked_numeric_cast<jlong, int32_t>(j_runtime_id));
+  if (!runtime) {
+    TDF_BASE_DLOG(WARNING) << "GetFrameStats, j_runtime_id invalid";
+    return nullptr;
+  }
+  std::shared_ptr<JavaScriptTaskRunner> js_runner = runtime->GetEngine()->GetJSRunner();
+  if (!js_runner) {
+    return nullptr;
+  }
+  JavaScriptTaskRunner::FrameStats stats = js_runner->GetFrameStats();
+  std::ostringstream stream;
+  stream << "{\"frameCount\":" << stats.frame_count
+         << ",\"overBudgetFrameCount\":" << stats.over_budget_frame_count
+         << ",\"frameBudget\":" << stats.frame_budget_in_us
+         << ",\"animationTime\":" << stats.animation_time_in_us
+         << ",\"taskTime\":" << stats.task_time_in_us
+         << ",\"idleTime\":" << stats.idle_time_in_us << "}";
+  std::string json = stream.str();
+  return j_env->NewStringUTF(json.c_str());
+}
+
+}  // namespace bridge
+}  // namespace hippy
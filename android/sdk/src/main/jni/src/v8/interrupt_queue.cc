@@ -21,7 +21,6 @@
  */
 
 #include "v8/interrupt_queue.h"
-#include "core/task/javascript_task.h"
 
 namespace hippy {
 inline namespace driver {
@@ -41,27 +40,42 @@ void InterruptQueue::PostTask(std::unique_ptr<Task> task) {
     task_queue_.push(std::move(task));
   }
 
+  // The task is queued before the flags are set, so whoever clears a flag and
+  // then runs the queue is guaranteed to see it.
+  uint32_t wake_ups = kInterruptPending;
   if (task_runner_) {
+    wake_ups |= kRunnerTaskPending;
+  }
+  uint32_t pending = pending_wake_ups_.fetch_or(wake_ups, std::memory_order_acq_rel);
+
+  if (task_runner_ && !(pending & kRunnerTaskPending)) {
     auto weak_self = weak_from_this();
-    auto js_task = std::make_unique<JavaScriptTask>();
-    js_task->callback = [weak_self]() {
+    task_runner_->PostTask([weak_self]() {
       auto self = weak_self.lock();
       if (self) {
-        self->Run();
+        self->OnWakeUp(kRunnerTaskPending);
       }
-    };
-    task_runner_->PostTask(std::move(js_task));
+    }, "InterruptQueue");
   }
 
-  isolate_->RequestInterrupt([](v8::Isolate* isolate, void* data) {
-    auto& map = InterruptQueue::GetPersistentMap();
-    auto index = static_cast<uint32_t>(reinterpret_cast<size_t>(data));
-    std::shared_ptr<InterruptQueue> queue;
-    auto flag = map.Find(index, queue);
-    if (flag && queue) {
-      queue->Run();
-    }
-  }, reinterpret_cast<void*>(id_));
+  if (!(pending & kInterruptPending)) {
+    isolate_->RequestInterrupt([](v8::Isolate* isolate, void* data) {
+      auto& map = InterruptQueue::GetPersistentMap();
+      auto index = static_cast<uint32_t>(reinterpret_cast<size_t>(data));
+      std::shared_ptr<InterruptQueue> queue;
+      auto flag = map.Find(index, queue);
+      if (flag && queue) {
+        queue->OnWakeUp(kInterruptPending);
+      }
+    }, reinterpret_cast<void*>(id_));
+  }
+}
+
+void InterruptQueue::OnWakeUp(PendingWakeUp wake_up) {
+  // Clear the flag first, tasks posted from now on arm a new wakeup unless
+  // this Run already picks them up.
+  pending_wake_ups_.fetch_and(~static_cast<uint32_t>(wake_up), std::memory_order_acq_rel);
+  Run();
 }
 
 void InterruptQueue::Run() {
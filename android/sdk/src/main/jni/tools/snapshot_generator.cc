@@ -0,0 +1,55 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Writes the startup snapshot of V8VM::CreateSnapshot to the given file, for
+// HippyEngine.V8InitParams.snapshotBlob. Build it with
+// ENABLE_SNAPSHOT_GENERATOR against the V8 the app ships and run it on a
+// device of the same ABI, V8 refuses to start from a blob made by another
+// build or with other flags.
+
+#include <stdio.h>
+
+#include <fstream>
+#include <string>
+
+#include "core/napi/v8/js_native_api_v8.h"
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: %s <snapshot file>\n", argv[0]);
+    return 1;
+  }
+  std::string blob = hippy::napi::V8VM::CreateSnapshot();
+  if (blob.empty()) {
+    fprintf(stderr, "CreateSnapshot failed\n");
+    return 1;
+  }
+  std::ofstream file(argv[1], std::ios::binary | std::ios::trunc);
+  file.write(blob.data(), static_cast<std::streamsize>(blob.size()));
+  file.close();
+  if (!file) {
+    fprintf(stderr, "cannot write %s\n", argv[1]);
+    return 1;
+  }
+  printf("%zu bytes written to %s\n", blob.size(), argv[1]);
+  return 0;
+}
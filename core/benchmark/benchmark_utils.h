@@ -0,0 +1,103 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>  // NOLINT(build/c++11)
+#include <condition_variable>  // NOLINT(build/c++11)
+#include <mutex>  // NOLINT(build/c++11)
+#include <vector>
+
+namespace hippy {
+namespace benchmark {
+
+inline uint64_t NowInNs() {
+  auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+// Spins instead of sleeping, so the thread keeps its core like a busy task.
+inline void BusyWaitInNs(uint64_t duration_in_ns) {
+  uint64_t end = NowInNs() + duration_in_ns;
+  while (NowInNs() < end) {
+  }
+}
+
+// Sorts `samples`, `percentile` is in [0, 100].
+inline uint64_t Percentile(std::vector<uint64_t>* samples, double percentile) {
+  if (samples->empty()) {
+    return 0;
+  }
+  std::sort(samples->begin(), samples->end());
+  auto index = static_cast<size_t>(static_cast<double>(samples->size() - 1) * percentile / 100);
+  return (*samples)[index];
+}
+
+inline double PerSecond(uint64_t count, uint64_t duration_in_ns) {
+  if (!duration_in_ns) {
+    return 0;
+  }
+  return static_cast<double>(count) * 1e9 / static_cast<double>(duration_in_ns);
+}
+
+inline double ToMs(uint64_t duration_in_ns) {
+  return static_cast<double>(duration_in_ns) / 1e6;
+}
+
+inline double ToUs(uint64_t duration_in_ns) {
+  return static_cast<double>(duration_in_ns) / 1e3;
+}
+
+// Counts down from the number of tasks a run posts, the benchmark thread waits
+// until the last one has run. Only the last CountDown takes the lock.
+class Latch {
+ public:
+  explicit Latch(uint64_t count) : count_(count), is_done_(count == 0) {}
+
+  void CountDown() {
+    if (count_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_done_ = true;
+    cv_.notify_all();
+  }
+
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return is_done_; });
+  }
+
+ private:
+  std::atomic<uint64_t> count_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool is_done_;
+};
+
+}  // namespace benchmark
+}  // namespace hippy
@@ -0,0 +1,129 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Builds, looks up, copies and destroys a JSValueWrapper tree shaped like a
+// bridge payload, an array of 10k small objects with nested arrays, on the
+// heap and in a JSValueArena. The V8 side of the conversion is measured by
+// js_value_conversion_benchmark in the Android SDK. Exits with 1 when a copy
+// differs from its source.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.h"
+#include "core/base/js_value_wrapper.h"
+
+namespace {
+
+using JSValueArena = hippy::base::JSValueArena;
+using JSValueWrapper = hippy::base::JSValueWrapper;
+using JSObjectType = JSValueWrapper::JSObjectType;
+using JSArrayType = JSValueWrapper::JSArrayType;
+using hippy::benchmark::NowInNs;
+
+constexpr uint32_t kElementCount = 10000;
+constexpr uint32_t kRunCount = 50;
+
+// The arena is null for the heap.
+JSValueWrapper BuildPayload(JSValueArena* arena) {
+  JSArrayType elements{JSArrayType::allocator_type(arena)};
+  elements.reserve(kElementCount);
+  for (uint32_t i = 0; i < kElementCount; ++i) {
+    JSArrayType margin{JSArrayType::allocator_type(arena)};
+    for (int32_t m = 1; m <= 4; ++m) {
+      margin.emplace_back(m);
+    }
+    JSObjectType style{JSObjectType::allocator_type(arena)};
+    style.emplace_back("color", JSValueWrapper("red"));
+    style.emplace_back("margin", JSValueWrapper(std::move(margin)));
+
+    JSObjectType element{JSObjectType::allocator_type(arena)};
+    element.reserve(5);
+    element.emplace_back("id", JSValueWrapper(i));
+    element.emplace_back("name", JSValueWrapper("item" + std::to_string(i)));
+    element.emplace_back("visible", JSValueWrapper(i % 2 == 0));
+    element.emplace_back("width", JSValueWrapper(i + 0.5));
+    element.emplace_back("style", JSValueWrapper(std::move(style)));
+    elements.emplace_back(std::move(element));
+  }
+  return JSValueWrapper(std::move(elements));
+}
+
+// Reads a field of every element, like a module reading its arguments.
+size_t LookUp(const JSValueWrapper& payload) {
+  size_t found = 0;
+  for (const auto& element : payload.ArrayValue()) {
+    found += element.ObjectValue().count("width");
+  }
+  return found;
+}
+
+struct Durations {
+  std::vector<uint64_t> build;
+  std::vector<uint64_t> look_up;
+  std::vector<uint64_t> copy;
+  std::vector<uint64_t> destroy;
+};
+
+bool RunOnce(bool is_arena, Durations* durations) {
+  std::unique_ptr<JSValueArena> arena = is_arena ? std::make_unique<JSValueArena>() : nullptr;
+  uint64_t begin = NowInNs();
+  auto payload = std::make_unique<JSValueWrapper>(BuildPayload(arena.get()));
+  durations->build.push_back(NowInNs() - begin);
+
+  begin = NowInNs();
+  size_t found = LookUp(*payload);
+  durations->look_up.push_back(NowInNs() - begin);
+
+  begin = NowInNs();
+  auto copy = std::make_unique<JSValueWrapper>(*payload);
+  durations->copy.push_back(NowInNs() - begin);
+  bool is_equal = *copy == *payload;
+
+  begin = NowInNs();
+  payload = nullptr;
+  arena = nullptr;
+  durations->destroy.push_back(NowInNs() - begin);
+  return is_equal && found == kElementCount;
+}
+
+double P50InMs(std::vector<uint64_t>* durations) {
+  return hippy::benchmark::ToMs(hippy::benchmark::Percentile(durations, 50));
+}
+
+}  // namespace
+
+int main() {
+  bool is_ok = true;
+  for (bool is_arena : {false, true}) {
+    Durations durations;
+    for (uint32_t i = 0; i < kRunCount; ++i) {
+      is_ok = RunOnce(is_arena, &durations) && is_ok;
+    }
+    printf("%-5s elements=%u  build p50=%7.2fms  look up p50=%7.2fms  copy p50=%7.2fms  "
+           "destroy p50=%7.2fms\n",
+           is_arena ? "arena" : "heap", kElementCount, P50InMs(&durations.build),
+           P50InMs(&durations.look_up), P50InMs(&durations.copy), P50InMs(&durations.destroy));
+  }
+  return is_ok ? 0 : 1;
+}
@@ -0,0 +1,142 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Cancels queued, delayed and idle tasks on a JavaScriptTaskRunner while it is
+// busy, then checks from the next task it runs that none of their closures is
+// still alive and none is counted as pending. Exits with 1 otherwise. Idle
+// tasks are not counted by GetPendingTaskCount.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.h"
+#include "core/task/idle_task.h"
+#include "core/task/javascript_task.h"
+#include "core/task/javascript_task_runner.h"
+
+namespace {
+
+using hippy::benchmark::Latch;
+using hippy::benchmark::NowInNs;
+
+constexpr uint32_t kTaskCount = 10000;
+// Stands for the CtxValues and buffers a closure keeps alive.
+constexpr size_t kPayloadSize = 1024;
+// Far enough that delayed tasks would still wait in the timer wheel.
+constexpr uint64_t kDelayInMs = 60 * 1000;
+
+enum class TaskKind { kQueued, kDelayed, kIdle };
+
+const char* GetName(TaskKind kind) {
+  switch (kind) {
+    case TaskKind::kQueued:
+      return "queued";
+    case TaskKind::kDelayed:
+      return "delayed";
+    case TaskKind::kIdle:
+      return "idle";
+  }
+  return "";
+}
+
+std::shared_ptr<hippy::base::Task> Post(JavaScriptTaskRunner* runner, TaskKind kind,
+                                        std::shared_ptr<std::string> payload) {
+  if (kind == TaskKind::kIdle) {
+    auto task = std::make_shared<IdleTask>();
+    task->callback = [payload](const IdleTask::Deadline&) {};
+    runner->PostIdleTask(task);
+    return task;
+  }
+  auto task = std::make_shared<JavaScriptTask>();
+  task->callback = [payload] {};
+  if (kind == TaskKind::kDelayed) {
+    runner->PostDelayedTask(task, kDelayInMs);
+  } else {
+    runner->PostTask(task);
+  }
+  return task;
+}
+
+bool RunBenchmark(TaskKind kind) {
+  auto runner = std::make_shared<JavaScriptTaskRunner>();
+  runner->Start();
+
+  // Keeps the runner busy until every task is posted and canceled.
+  Latch gate(1);
+  Latch blocked(1);
+  runner->PostTask([&gate, &blocked] {
+    blocked.CountDown();
+    gate.Wait();
+  }, "Benchmark");
+  blocked.Wait();
+
+  std::vector<std::weak_ptr<std::string>> payloads;
+  std::vector<std::shared_ptr<hippy::base::Task>> tasks;
+  payloads.reserve(kTaskCount);
+  tasks.reserve(kTaskCount);
+  for (uint32_t i = 0; i < kTaskCount; ++i) {
+    auto payload = std::make_shared<std::string>(kPayloadSize, 'x');
+    payloads.push_back(payload);
+    tasks.push_back(Post(runner.get(), kind, std::move(payload)));
+  }
+  size_t posted_pending_count = runner->GetPendingTaskCount();
+
+  uint64_t begin = NowInNs();
+  for (const auto& task : tasks) {
+    runner->CancelTask(task);
+  }
+  uint64_t cancel_time = NowInNs() - begin;
+
+  // The runner handles the cancels before it picks its next task.
+  size_t live_count = 0;
+  size_t pending_count = 0;
+  Latch checked(1);
+  runner->PostTask([&payloads, &live_count, &pending_count, &checked, &runner] {
+    for (const auto& payload : payloads) {
+      if (!payload.expired()) {
+        ++live_count;
+      }
+    }
+    pending_count = runner->GetPendingTaskCount();
+    checked.CountDown();
+  }, "Benchmark");
+  gate.CountDown();
+  checked.Wait();
+  runner->Terminate();
+
+  printf("%-8s cancel=%6.1fns/task  pending before=%zu after=%zu  "
+         "live closures=%zu  retained=%zuB\n",
+         GetName(kind), static_cast<double>(cancel_time) / kTaskCount, posted_pending_count,
+         pending_count, live_count, live_count * kPayloadSize);
+  return !live_count && !pending_count;
+}
+
+}  // namespace
+
+int main() {
+  bool is_ok = true;
+  for (TaskKind kind : {TaskKind::kQueued, TaskKind::kDelayed, TaskKind::kIdle}) {
+    is_ok = RunBenchmark(kind) && is_ok;
+  }
+  return is_ok ? 0 : 1;
+}
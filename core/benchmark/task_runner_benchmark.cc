@@ -0,0 +1,123 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Post contention on one TaskRunner with 1 to 8 producer threads. Throughput
+// is measured with producers posting empty tasks as fast as they can, the
+// post-to-run latency with producers pausing between posts, so that it shows
+// the cost of a post and a wakeup rather than the length of a flooded queue.
+
+#include <chrono>  // NOLINT(build/c++11)
+#include <memory>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "benchmark_utils.h"
+#include "core/base/task_runner.h"
+#include "core/task/javascript_task.h"
+
+namespace {
+
+using hippy::benchmark::Latch;
+using hippy::benchmark::NowInNs;
+
+constexpr uint32_t kFloodTaskCountPerProducer = 200000;
+constexpr uint32_t kPacedTaskCountPerProducer = 5000;
+constexpr auto kPacedPostInterval = std::chrono::microseconds(100);
+constexpr uint32_t kProducerCounts[] = {1, 2, 4, 8};
+
+enum class PostKind { kClosure, kTask };
+
+struct Run {
+  explicit Run(uint64_t task_count) : latencies_in_ns(task_count), latch(task_count) {}
+
+  // Written by the runner thread only, one slot per task.
+  std::vector<uint64_t> latencies_in_ns;
+  Latch latch;
+};
+
+void Produce(hippy::base::TaskRunner* runner, Run* run, PostKind kind, bool is_paced,
+             uint32_t first_index, uint32_t task_count) {
+  for (uint32_t i = first_index; i < first_index + task_count; ++i) {
+    if (is_paced) {
+      std::this_thread::sleep_for(kPacedPostInterval);
+    }
+    uint64_t post_time = NowInNs();
+    auto callback = [run, i, post_time] {
+      run->latencies_in_ns[i] = NowInNs() - post_time;
+      run->latch.CountDown();
+    };
+    if (kind == PostKind::kClosure) {
+      runner->PostTask(callback, "Benchmark");
+    } else {
+      auto task = std::make_shared<JavaScriptTask>();
+      task->callback = callback;
+      runner->PostTask(std::move(task));
+    }
+  }
+}
+
+// Returns the duration of the run, from the first post to the last task.
+uint64_t RunProducers(PostKind kind, uint32_t producer_count, bool is_paced, Run* run) {
+  uint32_t task_count = is_paced ? kPacedTaskCountPerProducer : kFloodTaskCountPerProducer;
+  auto runner = std::make_shared<hippy::base::TaskRunner>();
+  runner->Start();
+
+  uint64_t begin = NowInNs();
+  std::vector<std::thread> producers;
+  for (uint32_t p = 0; p < producer_count; ++p) {
+    producers.emplace_back(Produce, runner.get(), run, kind, is_paced, p * task_count,
+                           task_count);
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  run->latch.Wait();
+  uint64_t duration = NowInNs() - begin;
+  runner->Terminate();
+  return duration;
+}
+
+void RunBenchmark(PostKind kind, uint32_t producer_count) {
+  uint64_t flood_task_count = static_cast<uint64_t>(producer_count) * kFloodTaskCountPerProducer;
+  Run flood_run(flood_task_count);
+  uint64_t flood_duration = RunProducers(kind, producer_count, false, &flood_run);
+
+  Run paced_run(static_cast<uint64_t>(producer_count) * kPacedTaskCountPerProducer);
+  RunProducers(kind, producer_count, true, &paced_run);
+
+  printf("%-8s producers=%u  %10.0f tasks/s  paced p50=%7.1fus p99=%7.1fus\n",
+         kind == PostKind::kClosure ? "closure" : "task", producer_count,
+         hippy::benchmark::PerSecond(flood_task_count, flood_duration),
+         hippy::benchmark::ToUs(hippy::benchmark::Percentile(&paced_run.latencies_in_ns, 50)),
+         hippy::benchmark::ToUs(hippy::benchmark::Percentile(&paced_run.latencies_in_ns, 99)));
+}
+
+}  // namespace
+
+int main() {
+  for (PostKind kind : {PostKind::kClosure, PostKind::kTask}) {
+    for (uint32_t producer_count : kProducerCounts) {
+      RunBenchmark(kind, producer_count);
+    }
+  }
+  return 0;
+}
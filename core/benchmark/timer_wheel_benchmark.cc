@@ -0,0 +1,235 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// 100k timers with 50k of them canceled, the way pages create and clear
+// setTimeout timers. First on the bare TimerWheel next to the binary heap it
+// replaced, where a canceled timer stays queued until its deadline, then end
+// to end through TaskRunner::PostDelayedTask and CancelTask.
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "benchmark_utils.h"
+#include "core/base/task_runner.h"
+#include "core/base/timer_wheel.h"
+#include "core/task/javascript_task.h"
+
+namespace {
+
+using hippy::base::TimerNode;
+using hippy::base::TimerWheel;
+using hippy::benchmark::Latch;
+using hippy::benchmark::NowInNs;
+
+constexpr uint32_t kTimerCount = 100000;
+// Every other timer is canceled.
+constexpr uint32_t kCancelInterval = 2;
+// Deadlines of the bare structures, advanced in 1ms steps.
+constexpr uint64_t kMaxDeadlineInMs = 10000;
+// Delays of the runner timers, they really elapse. Long enough for the
+// cancel right after the post to arrive before the deadline.
+constexpr uint64_t kMinDelayInMs = 100;
+constexpr uint64_t kMaxDelayInMs = 300;
+
+std::vector<uint64_t> MakeDelays(uint64_t min_delay, uint64_t max_delay) {
+  std::mt19937_64 random(42);
+  std::uniform_int_distribution<uint64_t> distribution(min_delay, max_delay);
+  std::vector<uint64_t> delays(kTimerCount);
+  for (auto& delay : delays) {
+    delay = distribution(random);
+  }
+  return delays;
+}
+
+std::vector<std::shared_ptr<JavaScriptTask>> MakeTasks(std::atomic<uint32_t>* run_count) {
+  std::vector<std::shared_ptr<JavaScriptTask>> tasks(kTimerCount);
+  for (auto& task : tasks) {
+    task = std::make_shared<JavaScriptTask>();
+    task->callback = [run_count] { run_count->fetch_add(1, std::memory_order_relaxed); };
+  }
+  return tasks;
+}
+
+struct StructureResult {
+  uint64_t insert_time_in_ns = 0;
+  uint64_t cancel_time_in_ns = 0;
+  uint64_t advance_time_in_ns = 0;
+  // Entries still held once all timers were inserted and half canceled.
+  size_t retained_count = 0;
+  uint32_t run_count = 0;
+};
+
+void PrintStructureResult(const char* name, const StructureResult& result) {
+  printf("%-6s insert=%6.1fns/timer  cancel=%6.1fns/timer  advance=%8.2fms  retained=%zu  run=%u\n",
+         name,
+         static_cast<double>(result.insert_time_in_ns) / kTimerCount,
+         static_cast<double>(result.cancel_time_in_ns) / (kTimerCount / kCancelInterval),
+         hippy::benchmark::ToMs(result.advance_time_in_ns), result.retained_count,
+         result.run_count);
+}
+
+StructureResult RunTimerWheel(const std::vector<uint64_t>& delays) {
+  StructureResult result;
+  std::atomic<uint32_t> run_count{0};
+  auto tasks = MakeTasks(&run_count);
+  TimerWheel wheel(0);
+  std::vector<TimerNode*> nodes(kTimerCount);
+
+  uint64_t begin = NowInNs();
+  for (uint32_t i = 0; i < kTimerCount; ++i) {
+    nodes[i] = wheel.Insert(delays[i], tasks[i]);
+  }
+  result.insert_time_in_ns = NowInNs() - begin;
+
+  begin = NowInNs();
+  for (uint32_t i = 0; i < kTimerCount; i += kCancelInterval) {
+    wheel.Cancel(nodes[i]);
+  }
+  result.cancel_time_in_ns = NowInNs() - begin;
+  result.retained_count = wheel.Size();
+
+  begin = NowInNs();
+  for (uint64_t now = 1; now <= kMaxDeadlineInMs; ++now) {
+    wheel.Advance(now);
+    while (auto task = wheel.PopExpired()) {
+      task->Run();
+    }
+  }
+  result.advance_time_in_ns = NowInNs() - begin;
+  result.run_count = run_count.load();
+  return result;
+}
+
+// The delayed queue TaskRunner had before the timer wheel.
+StructureResult RunHeap(const std::vector<uint64_t>& delays) {
+  using Entry = std::pair<uint64_t, std::shared_ptr<hippy::base::Task>>;
+  struct Compare {
+    bool operator()(const Entry& left, const Entry& right) const {
+      return left.first > right.first;
+    }
+  };
+
+  StructureResult result;
+  std::atomic<uint32_t> run_count{0};
+  auto tasks = MakeTasks(&run_count);
+  std::priority_queue<Entry, std::vector<Entry>, Compare> heap;
+
+  uint64_t begin = NowInNs();
+  for (uint32_t i = 0; i < kTimerCount; ++i) {
+    heap.push(std::make_pair(delays[i], tasks[i]));
+  }
+  result.insert_time_in_ns = NowInNs() - begin;
+
+  begin = NowInNs();
+  for (uint32_t i = 0; i < kTimerCount; i += kCancelInterval) {
+    tasks[i]->canceled_ = true;
+  }
+  result.cancel_time_in_ns = NowInNs() - begin;
+  result.retained_count = heap.size();
+
+  begin = NowInNs();
+  for (uint64_t now = 1; now <= kMaxDeadlineInMs; ++now) {
+    while (!heap.empty() && heap.top().first <= now) {
+      std::shared_ptr<hippy::base::Task> task =
+          std::move(const_cast<Entry&>(heap.top()).second);
+      heap.pop();
+      if (!task->canceled_) {
+        task->Run();
+      }
+    }
+  }
+  result.advance_time_in_ns = NowInNs() - begin;
+  result.run_count = run_count.load();
+  return result;
+}
+
+// Timers are cleared right after they are set, as a page replacing its
+// pending timeouts does.
+void RunTaskRunner(const std::vector<uint64_t>& delays) {
+  uint32_t expected_run_count = kTimerCount - kTimerCount / kCancelInterval;
+  Latch latch(expected_run_count);
+  std::atomic<uint32_t> canceled_run_count{0};
+  std::vector<uint64_t> lateness_in_ns(kTimerCount);
+  auto runner = std::make_shared<hippy::base::TaskRunner>();
+  runner->Start();
+
+  uint64_t post_time = 0;
+  uint64_t cancel_time = 0;
+  for (uint32_t i = 0; i < kTimerCount; ++i) {
+    bool is_canceled = i % kCancelInterval == 0;
+    uint64_t deadline = NowInNs() + delays[i] * 1000 * 1000;
+    auto task = std::make_shared<JavaScriptTask>();
+    task->callback = [&latch, &lateness_in_ns, &canceled_run_count, i, is_canceled, deadline] {
+      if (is_canceled) {
+        canceled_run_count.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      uint64_t now = NowInNs();
+      lateness_in_ns[i] = now > deadline ? now - deadline : 0;
+      latch.CountDown();
+    };
+    uint64_t begin = NowInNs();
+    runner->PostDelayedTask(task, delays[i]);
+    post_time += NowInNs() - begin;
+    if (is_canceled) {
+      begin = NowInNs();
+      runner->CancelTask(task);
+      cancel_time += NowInNs() - begin;
+    }
+  }
+
+  latch.Wait();
+  // Canceled timers are unlinked as soon as the runner sees the cancel, none
+  // should be left once the last live timer has run.
+  size_t pending_count = runner->GetPendingTaskCount();
+  runner->Terminate();
+
+  std::vector<uint64_t> run_lateness;
+  run_lateness.reserve(expected_run_count);
+  for (uint32_t i = 0; i < kTimerCount; ++i) {
+    if (i % kCancelInterval) {
+      run_lateness.push_back(lateness_in_ns[i]);
+    }
+  }
+  printf("runner post=%6.1fns/timer  cancel=%6.1fns/timer  pending after run=%zu  "
+         "canceled run=%u  lateness p50=%.2fms p99=%.2fms\n",
+         static_cast<double>(post_time) / kTimerCount,
+         static_cast<double>(cancel_time) / (kTimerCount / kCancelInterval), pending_count,
+         canceled_run_count.load(),
+         hippy::benchmark::ToMs(hippy::benchmark::Percentile(&run_lateness, 50)),
+         hippy::benchmark::ToMs(hippy::benchmark::Percentile(&run_lateness, 99)));
+}
+
+}  // namespace
+
+int main() {
+  std::vector<uint64_t> delays = MakeDelays(1, kMaxDeadlineInMs);
+  PrintStructureResult("wheel", RunTimerWheel(delays));
+  PrintStructureResult("heap", RunHeap(delays));
+  RunTaskRunner(MakeDelays(kMinDelayInMs, kMaxDelayInMs));
+  return 0;
+}
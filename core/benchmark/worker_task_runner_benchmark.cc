@@ -0,0 +1,97 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// WorkerTaskRunner throughput over pool sizes under a mix of short and long
+// tasks, like file reads next to code cache writes. Every long task posts a
+// short follow-up from its worker, as loader callbacks do.
+
+#include <memory>
+
+#include "benchmark_utils.h"
+#include "core/task/common_task.h"
+#include "core/task/worker_task_runner.h"
+
+namespace {
+
+using hippy::benchmark::Latch;
+using hippy::benchmark::NowInNs;
+
+constexpr uint32_t kTaskCount = 20000;
+// One task in kLongTaskInterval is long.
+constexpr uint32_t kLongTaskInterval = 10;
+constexpr uint64_t kShortTaskTimeInNs = 2 * 1000;
+constexpr uint64_t kLongTaskTimeInNs = 200 * 1000;
+constexpr uint32_t kPoolSizes[] = {1, 2, 4, 8};
+
+void PostShortTask(WorkerTaskRunner* runner, Latch* latch) {
+  auto task = std::make_unique<CommonTask>();
+  task->func_ = [latch] {
+    hippy::benchmark::BusyWaitInNs(kShortTaskTimeInNs);
+    latch->CountDown();
+  };
+  runner->PostTask(std::move(task));
+}
+
+void PostLongTask(WorkerTaskRunner* runner, Latch* latch) {
+  auto task = std::make_unique<CommonTask>();
+  task->func_ = [runner, latch] {
+    hippy::benchmark::BusyWaitInNs(kLongTaskTimeInNs);
+    PostShortTask(runner, latch);
+    latch->CountDown();
+  };
+  runner->PostTask(std::move(task));
+}
+
+void RunBenchmark(uint32_t pool_size) {
+  uint32_t long_task_count = kTaskCount / kLongTaskInterval;
+  // Long tasks count their follow-up too.
+  Latch latch(kTaskCount + long_task_count);
+  auto runner = std::make_unique<WorkerTaskRunner>(pool_size);
+
+  uint64_t begin = NowInNs();
+  for (uint32_t i = 0; i < kTaskCount; ++i) {
+    if (i % kLongTaskInterval == 0) {
+      PostLongTask(runner.get(), &latch);
+    } else {
+      PostShortTask(runner.get(), &latch);
+    }
+  }
+  latch.Wait();
+  uint64_t duration = NowInNs() - begin;
+  runner->Terminate();
+
+  uint64_t busy_time = static_cast<uint64_t>(kTaskCount) * kShortTaskTimeInNs +
+                       static_cast<uint64_t>(long_task_count) * kLongTaskTimeInNs;
+  printf("pool_size=%u  %8.1fms  %8.0f tasks/s  speedup over serial=%.2f\n", pool_size,
+         hippy::benchmark::ToMs(duration),
+         hippy::benchmark::PerSecond(kTaskCount + long_task_count, duration),
+         static_cast<double>(busy_time) / static_cast<double>(duration));
+}
+
+}  // namespace
+
+int main() {
+  for (uint32_t pool_size : kPoolSizes) {
+    RunBenchmark(pool_size);
+  }
+  return 0;
+}
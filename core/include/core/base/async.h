@@ -0,0 +1,194 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#if defined(ENABLE_COROUTINE)
+
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace hippy {
+namespace base {
+
+template <typename T>
+class Async;
+
+namespace internal {
+
+class AsyncPromiseBase {
+ public:
+  struct FinalAwaiter {
+    bool await_ready() const noexcept { return false; }
+
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+      AsyncPromiseBase& promise = handle.promise();
+      if (promise.continuation_) {
+        return promise.continuation_;
+      }
+      if (promise.detached_) {
+        handle.destroy();
+      }
+      return std::noop_coroutine();
+    }
+
+    void await_resume() const noexcept {}
+  };
+
+  std::suspend_always initial_suspend() const noexcept { return {}; }
+  FinalAwaiter final_suspend() const noexcept { return {}; }
+  void unhandled_exception() const noexcept { std::terminate(); }
+
+ private:
+  template <typename T>
+  friend class hippy::base::Async;
+
+  std::coroutine_handle<> continuation_;
+  bool detached_ = false;
+};
+
+}  // namespace internal
+
+// Lazily started coroutine returning T. The body runs when the Async is
+// co_awaited and the awaiting coroutine resumes wherever the body finishes,
+// usually on the runner it last switched to with Schedule(). Detach() starts
+// it without a caller, the frame then frees itself when done.
+template <typename T>
+class Async {
+ public:
+  struct promise_type : internal::AsyncPromiseBase {
+    Async get_return_object() {
+      return Async(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    template <typename U>
+    void return_value(U&& value) {
+      value_.emplace(std::forward<U>(value));
+    }
+
+    std::optional<T> value_;
+  };
+
+  Async(Async&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+  Async& operator=(Async&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      handle_ = std::exchange(other.handle_, {});
+    }
+    return *this;
+  }
+  Async(const Async&) = delete;
+  Async& operator=(const Async&) = delete;
+  ~Async() { Reset(); }
+
+  bool await_ready() const noexcept { return false; }
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+    handle_.promise().continuation_ = awaiting;
+    return handle_;
+  }
+  T await_resume() { return std::move(*handle_.promise().value_); }
+
+  void Detach() && {
+    auto handle = std::exchange(handle_, {});
+    handle.promise().detached_ = true;
+    handle.resume();
+  }
+
+ private:
+  explicit Async(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+  void Reset() {
+    if (handle_) {
+      handle_.destroy();
+      handle_ = {};
+    }
+  }
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+template <>
+class Async<void> {
+ public:
+  struct promise_type : internal::AsyncPromiseBase {
+    Async get_return_object() {
+      return Async(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    void return_void() const noexcept {}
+  };
+
+  Async(Async&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+  Async& operator=(Async&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      handle_ = std::exchange(other.handle_, {});
+    }
+    return *this;
+  }
+  Async(const Async&) = delete;
+  Async& operator=(const Async&) = delete;
+  ~Async() { Reset(); }
+
+  bool await_ready() const noexcept { return false; }
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+    handle_.promise().continuation_ = awaiting;
+    return handle_;
+  }
+  void await_resume() const noexcept {}
+
+  void Detach() && {
+    auto handle = std::exchange(handle_, {});
+    handle.promise().detached_ = true;
+    handle.resume();
+  }
+
+ private:
+  explicit Async(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+  void Reset() {
+    if (handle_) {
+      handle_.destroy();
+      handle_ = {};
+    }
+  }
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+// Runs `func` on `runner` and hands back its result, the awaiting coroutine
+// resumes on that runner. Runner is TaskRunner or WorkerTaskRunner.
+template <typename Runner, typename F>
+Async<std::invoke_result_t<F&>> RunOn(std::shared_ptr<Runner> runner, F func) {
+  co_await runner->Schedule();
+  co_return func();
+}
+
+}  // namespace base
+}  // namespace hippy
+
+#endif  // ENABLE_COROUTINE
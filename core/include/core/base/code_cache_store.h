@@ -0,0 +1,140 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <mutex>  // NOLINT(build/c++11)
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hippy {
+namespace base {
+
+// Code caches on disk, addressed by a hash of the script content and the
+// engine tag, e.g. the V8 version and flags, so that a cache survives moves
+// and app upgrades for as long as the script and the engine stay the same.
+// Entries are also found by name, e.g. the script uri, before the script is
+// read, several names may share the entry of the same content. An index file
+// keeps sizes and use order, the least recently used entries go when the
+// directory would exceed its byte budget. Files are written to a temporary
+// name and renamed into place, reads map them. Uses by Get reach the index
+// file every kMaxUnsavedUseCount uses or with the next Put or Remove, those
+// of a process that exits before are lost.
+//
+// One instance per directory, see GetInstance. Thread safe, Put blocks on
+// disk I/O and belongs on a worker.
+class CodeCacheStore {
+ public:
+  // 64-bit content hash, fed incrementally.
+  class Hasher {
+   public:
+    void Update(const void* data, size_t length);
+    uint64_t Finish() const;
+
+   private:
+    void Mix(uint64_t word);
+
+    uint64_t hash_ = 0xcbf29ce484222325ULL;
+    uint64_t length_ = 0;
+    uint8_t pending_[8] = {};
+    size_t pending_size_ = 0;
+  };
+
+  // Read-only mapping of an entry, valid for as long as it is alive.
+  class Data {
+   public:
+    Data(void* address, size_t size) : address_(address), size_(size) {}
+    ~Data();
+
+    Data(const Data&) = delete;
+    Data& operator=(const Data&) = delete;
+
+    const uint8_t* data() const { return static_cast<const uint8_t*>(address_); }
+    size_t size() const { return size_; }
+
+   private:
+    void* address_;
+    size_t size_;
+  };
+
+  CodeCacheStore(const std::string& dir, const std::string& tag, size_t max_size_in_bytes);
+
+  CodeCacheStore(const CodeCacheStore&) = delete;
+  CodeCacheStore& operator=(const CodeCacheStore&) = delete;
+
+  // The store of dir, created by the first call, whose tag and budget stick.
+  // Later calls with another tag or budget get it too, with an error logged.
+  static std::shared_ptr<CodeCacheStore> GetInstance(const std::string& dir,
+                                                     const std::string& tag,
+                                                     size_t max_size_in_bytes);
+
+  std::string MakeKey(uint64_t content_hash) const;
+  // Key of the entry last put under name, empty when there is none.
+  std::string FindKey(const std::string& name);
+  // nullptr on a miss.
+  std::shared_ptr<Data> Get(const std::string& key);
+  // Replaces the entry of key and adds name to it. The entry name pointed to
+  // before is dropped once no other name points to it.
+  bool Put(const std::string& key, const std::string& name, const uint8_t* data, size_t size);
+  void Remove(const std::string& key);
+
+  size_t GetTotalSize();
+
+ private:
+  struct Entry {
+    size_t size;
+    uint64_t last_used;
+    std::vector<std::string> names;
+  };
+
+  static constexpr uint32_t kMaxUnsavedUseCount = 8;
+
+  // mutex_ must be held by all of them.
+  void LoadIndexIfNeeded();
+  void SaveIndex();
+  void RemoveEntry(const std::string& key);
+  void RemoveName(const std::string& name);
+  void Evict(const std::string& keep_key);
+
+  std::string GetPath(const std::string& file_name) const;
+
+  std::string dir_;
+  std::string tag_;
+  uint64_t tag_hash_;
+  size_t max_size_in_bytes_;
+  std::mutex mutex_;
+  bool is_index_loaded_ = false;
+  std::unordered_map<std::string, Entry> entries_;
+  std::unordered_map<std::string, std::string> name_to_key_;
+  size_t total_size_ = 0;
+  uint64_t use_clock_ = 0;
+  uint32_t unsaved_use_count_ = 0;
+  uint64_t temp_file_id_ = 0;
+};
+
+}  // namespace base
+}  // namespace hippy
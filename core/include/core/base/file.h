@@ -26,6 +26,7 @@
 #include <unistd.h>
 
 #include <fstream>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -50,6 +51,11 @@ class HippyFile {
   static int CreateDir(const unicode_string_view& path, mode_t mode);
   static int CheckDir(const unicode_string_view& path, int mode);
   static uint64_t GetFileModifytime(const unicode_string_view& file_path);
+  // Hands the file to on_chunk in pieces of at most chunk_size bytes as they
+  // are read.
+  static bool ReadFileInChunks(const unicode_string_view& file_path,
+                               size_t chunk_size,
+                               const std::function<void(const char* data, size_t length)>& on_chunk);
 
   template <typename CharType>
   static bool ReadFile(const unicode_string_view& file_path,
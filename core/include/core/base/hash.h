@@ -9,9 +9,9 @@ inline void hash_combine(size_t& seed, T const& v) {
   seed ^= hash<T>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
 }
 
-template <typename T>
-struct hash<vector<T>> {
-  size_t operator()(vector<T> const& in) const {
+template <typename T, typename A>
+struct hash<vector<T, A>> {
+  size_t operator()(vector<T, A> const& in) const {
     size_t size = in.size();
     size_t seed = 0;
     for (size_t i = 0; i < size; i++)
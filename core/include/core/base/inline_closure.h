@@ -0,0 +1,133 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hippy {
+namespace base {
+
+// Move-only `void()` callable that keeps small functors inline instead of on
+// the heap like std::function does. Bigger functors still fall back to a heap
+// allocation, kInlineSize is sized for the usual bridge callback captures.
+class InlineClosure {
+ public:
+  static constexpr size_t kInlineSize = 128;
+
+  InlineClosure() = default;
+  InlineClosure(std::nullptr_t) {}  // NOLINT(runtime/explicit)
+
+  template <typename F,
+            typename Functor = std::decay_t<F>,
+            typename = std::enable_if_t<
+                !std::is_same<Functor, InlineClosure>::value &&
+                std::is_invocable_r<void, Functor&>::value>>
+  InlineClosure(F&& f) {  // NOLINT(runtime/explicit)
+    if constexpr (FitsInline<Functor>()) {
+      new (storage_) Functor(std::forward<F>(f));
+      ops_ = &InlineOps<Functor>::kOps;
+    } else {
+      *reinterpret_cast<Functor**>(storage_) = new Functor(std::forward<F>(f));
+      ops_ = &HeapOps<Functor>::kOps;
+    }
+  }
+
+  InlineClosure(InlineClosure&& other) noexcept { MoveFrom(other); }
+
+  InlineClosure& operator=(InlineClosure&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(other);
+    }
+    return *this;
+  }
+
+  InlineClosure(const InlineClosure&) = delete;
+  InlineClosure& operator=(const InlineClosure&) = delete;
+
+  ~InlineClosure() { Reset(); }
+
+  void operator()() { ops_->invoke(storage_); }
+
+  explicit operator bool() const { return ops_ != nullptr; }
+
+  void Reset() {
+    if (ops_) {
+      ops_->destroy(storage_);
+      ops_ = nullptr;
+    }
+  }
+
+ private:
+  struct Ops {
+    void (*invoke)(void* storage);
+    void (*relocate)(void* from, void* to);
+    void (*destroy)(void* storage);
+  };
+
+  template <typename Functor>
+  static constexpr bool FitsInline() {
+    return sizeof(Functor) <= kInlineSize &&
+           alignof(Functor) <= alignof(std::max_align_t);
+  }
+
+  template <typename Functor>
+  struct InlineOps {
+    static void Invoke(void* storage) { (*static_cast<Functor*>(storage))(); }
+    static void Relocate(void* from, void* to) {
+      Functor* functor = static_cast<Functor*>(from);
+      new (to) Functor(std::move(*functor));
+      functor->~Functor();
+    }
+    static void Destroy(void* storage) { static_cast<Functor*>(storage)->~Functor(); }
+    static constexpr Ops kOps{&Invoke, &Relocate, &Destroy};
+  };
+
+  template <typename Functor>
+  struct HeapOps {
+    static Functor*& Get(void* storage) { return *static_cast<Functor**>(storage); }
+    static void Invoke(void* storage) { (*Get(storage))(); }
+    static void Relocate(void* from, void* to) { Get(to) = Get(from); }
+    static void Destroy(void* storage) { delete Get(storage); }
+    static constexpr Ops kOps{&Invoke, &Relocate, &Destroy};
+  };
+
+  void MoveFrom(InlineClosure& other) {
+    if (other.ops_) {
+      other.ops_->relocate(other.storage_, storage_);
+      ops_ = other.ops_;
+      other.ops_ = nullptr;
+    }
+  }
+
+  alignas(std::max_align_t) unsigned char storage_[kInlineSize];
+  const Ops* ops_ = nullptr;
+};
+
+}  // namespace base
+}  // namespace hippy
@@ -0,0 +1,51 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "core/base/inline_closure.h"
+#include "core/base/task.h"
+
+namespace hippy {
+namespace base {
+
+// Task wrapping an InlineClosure. Instances come from a process wide pool,
+// so posting a closure that fits inline does not allocate once the pool is
+// warm, see TaskRunner::PostTask(InlineClosure).
+class InlineTask : public Task {
+ public:
+  static std::shared_ptr<InlineTask> Create(InlineClosure closure);
+
+  explicit InlineTask(InlineClosure closure);
+
+  bool isPriorityTask() override;
+  void Run() override;
+  void OnCanceled() override;
+
+ private:
+  InlineClosure closure_;
+};
+
+}  // namespace base
+}  // namespace hippy
@@ -22,18 +22,225 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstdlib>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace hippy {
 namespace base {
 
+// Bump allocator for the containers of one JSValueWrapper tree, e.g. a bridge
+// payload. Their memory is only given back when the arena goes, all at once,
+// so the tree must not outlive it; copy construct a value to take it out of
+// the arena.
+class JSValueArena {
+ public:
+  explicit JSValueArena(size_t block_size = kDefaultBlockSize);
+  JSValueArena(const JSValueArena&) = delete;
+  JSValueArena& operator=(const JSValueArena&) = delete;
+
+  void* Allocate(size_t size, size_t alignment);
+  size_t GetAllocatedSize() const { return allocated_size_; }
+
+  static constexpr size_t kDefaultBlockSize = 16 * 1024;
+
+ private:
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  char* cursor_ = nullptr;
+  char* end_ = nullptr;
+  size_t block_size_;
+  size_t allocated_size_ = 0;
+};
+
+// Allocates from an arena, or from the heap without one. Copy constructed
+// containers use the heap, move constructed ones the allocator of the source.
+// Assignment never changes where a container lives, a container in an arena
+// copied or moved into stays in it.
+template <typename T>
+class JSValueAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::false_type;
+
+  JSValueAllocator() noexcept = default;
+  explicit JSValueAllocator(JSValueArena* arena) noexcept : arena_(arena) {}
+  template <typename U>
+  JSValueAllocator(const JSValueAllocator<U>& other) noexcept  // NOLINT
+      : arena_(other.arena()) {}
+
+  T* allocate(size_t n) {
+    if (arena_) {
+      return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+    }
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, size_t n) noexcept {
+    if (!arena_) {
+      std::allocator<T>().deallocate(p, n);
+    }
+  }
+  JSValueAllocator select_on_container_copy_construction() const noexcept {
+    return JSValueAllocator();
+  }
+
+  JSValueArena* arena() const noexcept { return arena_; }
+
+  template <typename U>
+  bool operator==(const JSValueAllocator<U>& rhs) const noexcept {
+    return arena_ == rhs.arena();
+  }
+  template <typename U>
+  bool operator!=(const JSValueAllocator<U>& rhs) const noexcept {
+    return arena_ != rhs.arena();
+  }
+
+ private:
+  JSValueArena* arena_ = nullptr;
+};
+
+// Object key. Short keys are stored inline, longer ones are interned for the
+// process, up to a bound, so keys repeated across a payload share one string.
+class JSValueKey {
+ public:
+  JSValueKey() { inline_[0] = '\0'; }
+  JSValueKey(const char* key)  // NOLINT
+      : JSValueKey(std::string_view(key)) {}
+  JSValueKey(const char* key, size_t length)
+      : JSValueKey(std::string_view(key, length)) {}
+  JSValueKey(const std::string& key)  // NOLINT
+      : JSValueKey(std::string_view(key)) {}
+  JSValueKey(std::string_view key);  // NOLINT
+  JSValueKey(const JSValueKey& source);
+  JSValueKey(JSValueKey&& source) noexcept;
+  ~JSValueKey();
+
+  JSValueKey& operator=(const JSValueKey& rhs);
+  JSValueKey& operator=(JSValueKey&& rhs) noexcept;
+
+  const char* c_str() const noexcept { return data(); }
+  const char* data() const noexcept;
+  size_t size() const noexcept { return size_; }
+  size_t length() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+  std::string_view view() const noexcept { return std::string_view(data(), size_); }
+  operator std::string() const { return std::string(data(), size_); }  // NOLINT
+
+  friend bool operator==(const JSValueKey& lhs, const JSValueKey& rhs) noexcept {
+    return lhs.view() == rhs.view();
+  }
+  friend bool operator==(const JSValueKey& lhs, const std::string& rhs) noexcept {
+    return lhs.view() == rhs;
+  }
+  friend bool operator==(const std::string& lhs, const JSValueKey& rhs) noexcept {
+    return rhs.view() == lhs;
+  }
+  friend bool operator==(const JSValueKey& lhs, const char* rhs) noexcept {
+    return lhs.view() == rhs;
+  }
+  friend bool operator!=(const JSValueKey& lhs, const JSValueKey& rhs) noexcept {
+    return !(lhs == rhs);
+  }
+  friend bool operator<(const JSValueKey& lhs, const JSValueKey& rhs) noexcept {
+    return lhs.view() < rhs.view();
+  }
+
+  static constexpr size_t kInlineCapacity = 15;
+  static constexpr size_t kMaxInternedSize = 128;
+  static constexpr size_t kMaxInternedCount = 4096;
+
+ private:
+  enum class Storage : uint8_t { Inline, Interned, Owned };
+
+  inline void deallocate();
+
+  union {
+    char inline_[kInlineCapacity + 1];
+    const std::string* interned_;
+    std::string* owned_;
+  };
+  uint32_t size_ = 0;
+  Storage storage_ = Storage::Inline;
+};
+
+class JSValueWrapper;
+
+// Object entries in insertion order in one vector. Small objects are
+// searched linearly, larger ones through an index of key hashes built on
+// demand.
+class JSValueObject {
+ public:
+  using key_type = JSValueKey;
+  using mapped_type = JSValueWrapper;
+  using value_type = std::pair<JSValueKey, JSValueWrapper>;
+  using allocator_type = JSValueAllocator<value_type>;
+  using container_type = std::vector<value_type, allocator_type>;
+  using size_type = size_t;
+  using iterator = container_type::iterator;
+  using const_iterator = container_type::const_iterator;
+
+  JSValueObject();
+  explicit JSValueObject(const allocator_type& allocator);
+  JSValueObject(const JSValueObject& source);
+  JSValueObject(JSValueObject&& source) noexcept;
+  ~JSValueObject();
+
+  JSValueObject& operator=(const JSValueObject& rhs);
+  JSValueObject& operator=(JSValueObject&& rhs) noexcept;
+
+  iterator begin() noexcept;
+  iterator end() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  size_type size() const noexcept;
+  bool empty() const noexcept { return size() == 0; }
+  void reserve(size_type count);
+  void clear() noexcept;
+
+  JSValueWrapper& operator[](const JSValueKey& key);
+  JSValueWrapper& operator[](JSValueKey&& key);
+  iterator find(const JSValueKey& key);
+  const_iterator find(const JSValueKey& key) const;
+  size_type count(const JSValueKey& key) const;
+  std::pair<iterator, bool> emplace(JSValueKey key, JSValueWrapper value);
+  std::pair<iterator, bool> insert(const value_type& value);
+  size_type erase(const JSValueKey& key);
+  // Appends without looking for the key, which must not be in the object.
+  value_type& emplace_back(JSValueKey key, JSValueWrapper value);
+
+  allocator_type get_allocator() const noexcept;
+
+  // Order does not matter, like for the unordered_map objects used to be.
+  bool operator==(const JSValueObject& rhs) const noexcept;
+  bool operator!=(const JSValueObject& rhs) const noexcept { return !operator==(rhs); }
+
+  static constexpr size_type kIndexThreshold = 16;
+
+ private:
+  using Index = std::unordered_multimap<size_t, size_type>;
+
+  size_type FindIndex(const JSValueKey& key) const;
+  // Uses the index when there is one, never allocates.
+  size_type FindIndexIfIndexed(const JSValueKey& key) const noexcept;
+  void AddToIndex(size_type pos) const;
+
+  container_type entries_;
+  mutable std::unique_ptr<Index> index_;
+};
+
 class JSValueWrapper final {
  public:
-  using JSObjectType = typename std::unordered_map<std::string, JSValueWrapper>;
-  using JSArrayType = typename std::vector<JSValueWrapper>;
+  using JSObjectType = JSValueObject;
+  using JSArrayType = std::vector<JSValueWrapper, JSValueAllocator<JSValueWrapper>>;
   enum class Type {
     Undefined,
     Null,
@@ -53,6 +260,7 @@ class JSValueWrapper final {
  public:
   JSValueWrapper() {}
   JSValueWrapper(const JSValueWrapper& source);
+  JSValueWrapper(JSValueWrapper&& source) noexcept;
 
   JSValueWrapper(int32_t int32_value)  // NOLINT
       : type_(Type::Int32), int32_value_(int32_value) {}
@@ -75,13 +283,14 @@ class JSValueWrapper final {
   explicit JSValueWrapper(const JSObjectType& object_value)
       : type_(Type::Object), object_value_(object_value) {}
   explicit JSValueWrapper(JSArrayType&& array_value)
-      : type_(Type::Array), array_value_(array_value) {}
+      : type_(Type::Array), array_value_(std::move(array_value)) {}
   explicit JSValueWrapper(JSArrayType& array_value)
       : type_(Type::Array), array_value_(array_value) {}
   ~JSValueWrapper();
 
  public:
   JSValueWrapper& operator=(const JSValueWrapper& rhs) noexcept;
+  JSValueWrapper& operator=(JSValueWrapper&& rhs) noexcept;
   JSValueWrapper& operator=(const int32_t rhs) noexcept;
   JSValueWrapper& operator=(const uint32_t rhs) noexcept;
   JSValueWrapper& operator=(const double rhs) noexcept;
@@ -150,6 +359,13 @@ class JSValueWrapper final {
 }  // namespace base
 }  // namespace hippy
 
+template <>
+struct std::hash<hippy::base::JSValueKey> {
+  std::size_t operator()(const hippy::base::JSValueKey& key) const noexcept {
+    return std::hash<std::string_view>{}(key.view());
+  }
+};
+
 template <>
 struct std::hash<hippy::base::JSValueWrapper> {
   std::size_t operator()(
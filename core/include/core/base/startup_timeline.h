@@ -0,0 +1,100 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <mutex>  // NOLINT(build/c++11)
+#include <string>
+#include <vector>
+
+namespace hippy {
+namespace base {
+
+// Timestamps of the phases between starting the process and the first
+// screen, in MonotonicallyIncreasingTimeInUs. Only the first record of each
+// phase is kept, later ones cost an atomic load. Thread safe.
+class StartupTimeline {
+ public:
+  enum class Phase : uint8_t {
+    kPlatformInit,
+    kIsolateCreation,
+    kContextCreation,
+    kBootstrap,
+    kGlobalModuleRegistration,
+    kBundleRead,
+    kCodeCacheRead,
+    kCompile,
+    kFirstScriptRun,
+    kFirstCallNatives,
+    kCount
+  };
+
+  struct Event {
+    Phase phase;
+    uint64_t begin_in_us;
+    uint64_t end_in_us;
+  };
+
+  // Records begin to now when it goes out of scope.
+  class ScopedPhase {
+   public:
+    ScopedPhase(StartupTimeline* timeline, Phase phase);
+    ~ScopedPhase();
+
+    ScopedPhase(const ScopedPhase&) = delete;
+    ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+   private:
+    StartupTimeline* timeline_;
+    Phase phase_;
+    uint64_t begin_in_us_;
+  };
+
+  // Phases of the process rather than of an engine, e.g. kPlatformInit.
+  static StartupTimeline* GetProcessTimeline();
+  static const char* GetPhaseName(Phase phase);
+
+  void Record(Phase phase, uint64_t begin_in_us, uint64_t end_in_us);
+  // Records an instant.
+  void Mark(Phase phase);
+  bool HasRecorded(Phase phase) const;
+  // Adds the events of other whose phase has not been recorded here.
+  void Merge(const StartupTimeline& other);
+
+  // Sorted by begin.
+  std::vector<Event> GetEvents() const;
+  // Complete events of the trace event format, for chrome://tracing and
+  // Perfetto.
+  std::string ToChromeTraceJson() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::atomic<uint32_t> recorded_mask_{0};
+  std::vector<Event> events_;
+};
+
+}  // namespace base
+}  // namespace hippy
@@ -24,9 +24,16 @@
 
 #include <stdint.h>
 
+#include <atomic>
+
+class JavaScriptTaskRunner;
+
 namespace hippy {
 namespace base {
 
+struct TimerNode;
+class TaskRunner;
+
 class Task {
  public:
   using TaskId = uint32_t;
@@ -35,9 +42,35 @@ class Task {
   virtual ~Task() = default;
   virtual bool isPriorityTask() = 0;
   virtual void Run() = 0;
+  // Called on the runner thread once a queued task is canceled, tasks should
+  // drop their callbacks here so captured objects are released right away.
+  virtual void OnCanceled() {}
 
   TaskId id_;
-  bool canceled_ = false;
+  std::atomic<bool> canceled_{false};
+  // Label used by TaskTelemetry, must have static storage duration.
+  const char* source_ = nullptr;
+
+ private:
+  friend class TaskRunner;
+  friend class TaskTelemetry;
+  friend class ::JavaScriptTaskRunner;
+
+  // Runner the task was last posted to, only compared, never dereferenced.
+  // CancelTask on any other runner just marks the task as canceled.
+  std::atomic<TaskRunner*> runner_{nullptr};
+  // Queue of a runner subclass the task waits in, e.g. the frame queues of
+  // JavaScriptTaskRunner, 0 while it is in none. Lets cancels skip the scan.
+  std::atomic<uint8_t> runner_queue_{0};
+
+  // When the task was posted, or became due for delayed tasks. Only written
+  // while telemetry is enabled.
+  uint64_t post_time_in_us_ = 0;
+
+  // Runner thread only. `timer_node_` is set while the task waits in the
+  // timer wheel, `queued_count_` counts its entries in the FIFO queue.
+  TimerNode* timer_node_ = nullptr;
+  uint32_t queued_count_ = 0;
 };
 
 }  // namespace base
@@ -22,16 +22,24 @@
 
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <condition_variable>  // NOLINT(build/c++11)
 #include <memory>
 #include <mutex>  // NOLINT(build/c++11)
 #include <queue>
-#include <utility>
-#include <vector>
 
+#if defined(ENABLE_COROUTINE)
+#include <coroutine>
+#endif
+
+#include "core/base/inline_closure.h"
+#include "core/base/mpsc_queue.h"
+#include "core/base/task_telemetry.h"
 #include "core/base/thread.h"
+#include "core/base/timer_wheel.h"
 
 namespace hippy {
 namespace base {
@@ -42,35 +50,89 @@ class TaskRunner : public Thread {
   using DelayedTimeInMs = uint64_t;
 
   TaskRunner();
+  explicit TaskRunner(const Options& options);
   virtual ~TaskRunner();
 
   void Run() override;
-  void Terminate();
+  virtual void Terminate();
   void PostTask(std::shared_ptr<Task> task);
+  // Wraps the closure in a pooled InlineTask, prefer this for hot paths.
+  void PostTask(InlineClosure closure, const char* source = nullptr);
   void PostDelayedTask(std::shared_ptr<Task> task,
                        DelayedTimeInMs delay_in_milliseconds);
+  // Lock free, the runner thread then unlinks delayed tasks and calls
+  // Task::OnCanceled on queued ones, so their closures are released before
+  // the task would have reached the front of the queue. Must be called on the
+  // runner the task was posted to, any other one only marks it as canceled.
   void CancelTask(const std::shared_ptr<Task>& task);
+  // Tasks posted to this runner that have neither run nor been canceled.
+  size_t GetPendingTaskCount() const;
+
+  // Telemetry is off until enabled and stays on for the runner's lifetime,
+  // the returned object lives as long as the runner. Thread safe.
+  TaskTelemetry* EnableTelemetry();
+  TaskTelemetry* GetTelemetry() const;
+
+#if defined(ENABLE_COROUTINE)
+  // `co_await runner->Schedule()` continues the coroutine on this runner. A
+  // coroutine waiting on a terminated runner is never resumed.
+  class ScheduleAwaiter {
+   public:
+    explicit ScheduleAwaiter(TaskRunner* runner) : runner_(runner) {}
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle);
+    void await_resume() const noexcept {}
+
+   private:
+    TaskRunner* runner_;
+  };
+
+  ScheduleAwaiter Schedule() { return ScheduleAwaiter(this); }
+#endif
 
  protected:
-  void PostTaskNoLock(std::shared_ptr<Task> task);
-  std::shared_ptr<Task> popTaskFromDelayedQueueNoLock(DelayedTimeInMs now);
+  // Everything below except `Unpark` must only be called on the runner thread.
+  void RunTask(Task* task);
+  void DrainIncomingQueue();
+  // Runners with queues of their own override this to unlink the task there
+  // too, and call Task::OnCanceled for it.
+  virtual void RemoveCanceledTask(Task* task);
   std::shared_ptr<Task> GetNext();
+  // Non-blocking GetNext, returns nullptr when nothing is ready to run.
+  std::shared_ptr<Task> TakeNext();
+  void Park(DelayedTimeInMs now);
+  virtual void Unpark();
+
+  // Hooks for runners that schedule work outside of the FIFO queue, called on
+  // the runner thread. Urgent tasks run before queued tasks, idle tasks only
+  // when the queue is empty.
+  virtual std::shared_ptr<Task> GetNextUrgentTask(DelayedTimeInMs now);
+  virtual std::shared_ptr<Task> GetNextIdleTask(DelayedTimeInMs now);
+  // Latest time the runner may stay parked, kNoWakeUpTime if it does not care.
+  virtual DelayedTimeInMs GetNextWakeUpTime(DelayedTimeInMs now);
+
+  static constexpr DelayedTimeInMs kNoWakeUpTime = UINT64_MAX;
 
  protected:
-  bool is_terminated_;
-  std::queue<std::shared_ptr<Task>> task_queue_;
+  enum class IncomingType { kTask, kDelayedTask, kCancel };
 
-  using DelayedEntry = std::pair<DelayedTimeInMs, std::shared_ptr<Task>>;
-  struct DelayedEntryCompare {
-    bool operator()(const DelayedEntry& left, const DelayedEntry& right) const {
-      return left.first > right.first;
-    }
+  struct IncomingEntry {
+    std::shared_ptr<Task> task;
+    IncomingType type = IncomingType::kTask;
+    DelayedTimeInMs deadline = 0;
   };
-  std::priority_queue<DelayedEntry,
-                      std::vector<DelayedEntry>,
-                      DelayedEntryCompare>
-      delayed_task_queue_;
 
+  std::atomic<bool> is_terminated_;
+  std::atomic<size_t> pending_task_count_;
+  std::atomic<TaskTelemetry*> telemetry_;
+  // Producers only touch `incoming_queue_`, the runner thread moves entries
+  // into `task_queue_` and `timer_wheel_` which are never shared.
+  MpscQueue<IncomingEntry> incoming_queue_;
+  std::queue<std::shared_ptr<Task>> task_queue_;
+  TimerWheel timer_wheel_;
+
+  // Only used to park the runner thread when there is nothing to do.
+  std::atomic<bool> is_parked_;
   std::mutex mutex_;
   std::condition_variable cv_;
 };
@@ -0,0 +1,104 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace hippy {
+namespace base {
+
+class Task;
+
+// Lock-free histogram with power of two buckets, bucket 0 counts zeros and
+// bucket i counts values in [2^(i-1), 2^i).
+class Histogram {
+ public:
+  static constexpr size_t kBucketCount = 32;
+
+  struct Snapshot {
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t max = 0;
+    uint64_t buckets[kBucketCount] = {};
+
+    // Upper bound of the bucket holding the given percentile, in [0, 100].
+    uint64_t Percentile(double percentile) const;
+  };
+
+  void Record(uint64_t value);
+  Snapshot GetSnapshot() const;
+
+ private:
+  std::atomic<uint64_t> count_{0};
+  std::atomic<uint64_t> sum_{0};
+  std::atomic<uint64_t> max_{0};
+  std::atomic<uint64_t> buckets_[kBucketCount] = {};
+};
+
+// Per task source statistics of a runner: time from post to start, run time
+// and the queue depth sampled at post time. Sources are identified by
+// Task::source_, which must point to a string with static storage duration.
+// Recording never takes a lock, a fixed number of sources is tracked and the
+// rest are folded into the last slot.
+class TaskTelemetry {
+ public:
+  struct SourceSnapshot {
+    std::string source;
+    Histogram::Snapshot latency_in_us;
+    Histogram::Snapshot run_time_in_us;
+    Histogram::Snapshot queue_depth;
+  };
+
+  static constexpr size_t kMaxSourceCount = 32;
+  static constexpr uint32_t kQueueDepthSampleInterval = 16;
+
+  // `delay_in_us` is the delay of delayed tasks, whose latency is counted
+  // from the time they become due.
+  void OnTaskPosted(Task* task, size_t queue_depth, uint64_t delay_in_us);
+  // Returns the start time to hand back to OnTaskFinished.
+  uint64_t OnTaskStarted(const Task* task);
+  void OnTaskFinished(const Task* task, uint64_t start_time_in_us);
+
+  std::vector<SourceSnapshot> GetSnapshot() const;
+
+ private:
+  struct Source {
+    std::atomic<const char*> name{nullptr};
+    Histogram latency_in_us;
+    Histogram run_time_in_us;
+    Histogram queue_depth;
+  };
+
+  Source& GetSource(const char* name);
+
+  Source sources_[kMaxSourceCount];
+  std::atomic<uint32_t> post_count_{0};
+};
+
+}  // namespace base
+}  // namespace hippy
@@ -22,7 +22,9 @@
 
 #pragma once
 
+#include <limits.h>
 #include <pthread.h>
+#include <stdint.h>
 
 #include "core/base/thread_id.h"
 
@@ -31,6 +33,20 @@ namespace base {
 
 class Thread {
  public:
+  // Scheduling parameters a thread applies to itself before Run. kInherit
+  // leaves the value inherited from the creating thread untouched.
+  struct SchedulingParams {
+    static constexpr int kInherit = INT_MIN;
+
+    // setpriority() nice value, only supported on Linux and Android.
+    int nice = kInherit;
+    // SCHED_OTHER, SCHED_FIFO, ... and the matching sched_priority.
+    int policy = kInherit;
+    int priority = 0;
+    // Bit i allows CPU i, 0 keeps the inherited mask. Linux and Android only.
+    uint64_t cpu_affinity = 0;
+  };
+
   class Options {
    public:
     Options() : name_("hippy:<unknown>"), stack_size_(0) {}
@@ -39,10 +55,17 @@ class Thread {
 
     const char* name() const { return name_; }
     size_t stack_size() const { return stack_size_; }
+    const SchedulingParams& scheduling_params() const { return scheduling_params_; }
+
+    Options& set_scheduling_params(const SchedulingParams& params) {
+      scheduling_params_ = params;
+      return *this;
+    }
 
    private:
     const char* name_;
     size_t stack_size_;
+    SchedulingParams scheduling_params_;
   };
 
  public:
@@ -58,12 +81,20 @@ class Thread {
   void Join() const;
 
   inline const char* name() const { return name_; }
+  inline const SchedulingParams& scheduling_params() const { return scheduling_params_; }
+
+  // Apply to or read from the calling thread. Settings the process is not
+  // allowed to use, such as realtime policies without the capability, are
+  // logged and skipped, the result tells whether everything was applied.
+  static bool SetCurrentThreadSchedulingParams(const SchedulingParams& params);
+  static SchedulingParams GetCurrentThreadSchedulingParams();
 
   static const int kMaxThreadNameLength = 16;
 
  protected:
   char name_[kMaxThreadNameLength]{};
   size_t stack_size_;
+  SchedulingParams scheduling_params_;
   pthread_t thread_{};
 
   ThreadId thread_id_;
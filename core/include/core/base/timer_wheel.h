@@ -0,0 +1,113 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
+namespace hippy {
+namespace base {
+
+class Task;
+class TimerWheel;
+
+struct TimerNode {
+  TimerNode* prev = nullptr;
+  TimerNode* next = nullptr;
+  TimerWheel* wheel = nullptr;
+  uint64_t deadline = 0;
+  // Index of the list the node is linked into, see TimerWheel::GetList.
+  uint32_t level = 0;
+  uint32_t slot = 0;
+  std::shared_ptr<Task> task;
+};
+
+// Hierarchical timing wheel with millisecond resolution. Four levels of 64
+// slots cover about 4.6 hours, later deadlines wait in an overflow list that
+// is re-sorted once per revolution of the last level. Insert and Cancel are
+// O(1), Advance cascades coarse slots into finer ones as time goes by.
+// Not thread safe, TaskRunner only uses it on the runner thread.
+class TimerWheel {
+ public:
+  using TimeInMs = uint64_t;
+
+  static constexpr TimeInMs kNoExpiryTime = UINT64_MAX;
+
+  explicit TimerWheel(TimeInMs now);
+  ~TimerWheel();
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  // Tasks whose deadline is not later than the wheel time are expired at once.
+  TimerNode* Insert(TimeInMs deadline, std::shared_ptr<Task> task);
+  // Unlinks the node and drops its task, the node must belong to this wheel.
+  void Cancel(TimerNode* node);
+  // Moves every task whose deadline is not later than `now` to the expired
+  // list, roughly in deadline order.
+  void Advance(TimeInMs now);
+  // Returns nullptr when there is no expired task left.
+  std::shared_ptr<Task> PopExpired();
+  // A lower bound of the next deadline, kNoExpiryTime when the wheel is empty.
+  TimeInMs NextExpiryTime() const;
+
+  size_t Size() const { return size_; }
+
+ private:
+  static constexpr uint32_t kLevelCount = 4;
+  static constexpr uint32_t kSlotBits = 6;
+  static constexpr uint32_t kSlotCount = 1u << kSlotBits;
+  static constexpr uint64_t kSlotMask = kSlotCount - 1;
+  static constexpr uint32_t kOverflowLevel = kLevelCount;
+  static constexpr uint32_t kExpiredLevel = kLevelCount + 1;
+
+  struct List {
+    TimerNode* head = nullptr;
+    TimerNode* tail = nullptr;
+  };
+
+  List& GetList(uint32_t level, uint32_t slot);
+  void Link(TimerNode* node, uint32_t level, uint32_t slot);
+  void Unlink(TimerNode* node);
+  void Place(TimerNode* node);
+  void Cascade(uint32_t level, uint32_t slot);
+  void CascadeOverflow();
+  TimeInMs NextEventTime() const;
+  TimerNode* AllocateNode();
+  void FreeNode(TimerNode* node);
+
+  TimeInMs now_;
+  size_t size_ = 0;
+  List slots_[kLevelCount][kSlotCount];
+  uint64_t occupied_[kLevelCount] = {};
+  List overflow_;
+  List expired_;
+  // Recycled nodes, linked through `next`.
+  TimerNode* free_nodes_ = nullptr;
+  size_t free_node_count_ = 0;
+};
+
+}  // namespace base
+}  // namespace hippy
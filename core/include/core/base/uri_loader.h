@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -35,6 +36,7 @@ class UriLoader {
  public:
   using unicode_string_view = tdf::base::unicode_string_view;
   using u8string = unicode_string_view::u8string;
+  using char8_t_ = unicode_string_view::char8_t_;
 
   UriLoader() {}
   virtual ~UriLoader() {}
@@ -45,6 +47,20 @@ class UriLoader {
   virtual bool RequestUntrustedContent(
       const unicode_string_view& uri,
       u8string& content) = 0;
+
+  // Reads on the calling thread and hands the content to on_chunk piece by
+  // piece as it arrives, so that consumers can start before the end. The
+  // default reads everything first.
+  virtual bool RequestUntrustedContentInChunks(
+      const unicode_string_view& uri,
+      const std::function<void(const char8_t_* data, size_t length)>& on_chunk) {
+    u8string content;
+    if (!RequestUntrustedContent(uri, content)) {
+      return false;
+    }
+    on_chunk(content.c_str(), content.length());
+    return true;
+  }
 };
 }  // namespace base
 }  // namespace hippy
@@ -22,10 +22,14 @@
 
 #pragma once
 
+#include "core/base/async.h"
 #include "core/base/base_time.h"
+#include "core/base/code_cache_store.h"
 #include "core/base/common.h"
 #include "core/base/file.h"
+#include "core/base/inline_task.h"
 #include "core/base/macros.h"
+#include "core/base/startup_timeline.h"
 #include "core/base/task.h"
 #include "core/base/task_runner.h"
 #include "core/base/thread.h"
@@ -33,6 +37,7 @@
 #include "core/base/uri_loader.h"
 #include "core/base/string_view_utils.h"
 #include "core/engine.h"
+#include "core/engine_pool.h"
 #include "core/modules/console_module.h"
 #include "core/modules/contextify_module.h"
 #include "core/modules/module_base.h"
@@ -48,6 +53,7 @@
 #include "core/napi/v8/js_native_api_v8.h"
 #include "core/napi/v8/js_native_turbo_v8.h"
 #include "core/napi/v8/memory_module.h"
+#include "core/napi/v8/script_streamer_v8.h"
 #include "core/inspector/bridge.h"
 #ifndef V8_WITHOUT_INSPECTOR
 #include "core/inspector/v8_inspector_client_impl.h"
@@ -59,6 +65,9 @@
 #endif
 
 #include "core/task/common_task.h"
+#include "core/task/idle_task.h"
 #include "core/task/javascript_task.h"
 #include "core/task/javascript_task_runner.h"
+#include "core/task/javascript_thread_pool.h"
+#include "core/task/shared_worker_pool.h"
 #include "core/task/worker_task_runner.h"
@@ -28,6 +28,7 @@
 
 #include "base/logging.h"
 #include "core/base/common.h"
+#include "core/base/startup_timeline.h"
 #include "core/napi/js_native_api_types.h"
 #include "core/task/javascript_task_runner.h"
 #include "core/task/worker_task_runner.h"
@@ -44,18 +45,56 @@ class Engine: public std::enable_shared_from_this<Engine> {
   using VM = hippy::napi::VM;
   using VMInitParam = hippy::napi::VMInitParam;
   using RegisterFunction = hippy::base::RegisterFunction;
+  using SchedulingParams = hippy::base::Thread::SchedulingParams;
+
+  struct ThreadConfig {
+    SchedulingParams js_thread;
+    SchedulingParams worker_thread;
+    // Applied to the JS thread as soon as it starts, until EndStartupBoost is
+    // called or the duration runs out. 0 disables the boost.
+    SchedulingParams js_startup_boost;
+    uint32_t startup_boost_duration_in_ms = 0;
+    // Runs worker tasks on SharedWorkerPool::GetInstance() instead of threads
+    // owned by this engine, worker_thread is ignored then.
+    bool use_shared_worker_pool = false;
+    // Runs JS tasks in slices on JavaScriptThreadPool::GetInstance() instead
+    // of a thread owned by this engine, the VM is entered with a v8::Locker
+    // around every slice. js_thread and the startup boost are ignored then.
+    bool use_shared_js_thread_pool = false;
+  };
 
   Engine();
   virtual ~Engine();
 
   void AsyncInit(const std::shared_ptr<VMInitParam>& param = nullptr,
                  std::unique_ptr<RegisterMap> map = std::make_unique<RegisterMap>());
+  // Hands an engine that was initialized ahead of time, see EnginePool, to its
+  // owner. The kVMCreateCBKey callback of map runs on the JS thread as it
+  // would have in AsyncInit.
+  void Adopt(std::unique_ptr<RegisterMap> map);
+  // Creates a context on the JS thread right after the VM, the first scope
+  // takes it instead of creating its own. Must be called after AsyncInit.
+  void PrewarmContext();
+  // JS thread only. Returns the pre-warmed context once, nullptr otherwise.
+  std::shared_ptr<hippy::napi::Ctx> TakeWarmContext();
+  // JS thread only. Keeps a scope that Scope::Recycle succeeded on for the
+  // next scope created on this engine, replacing the one kept before.
+  void KeepRecycledScope(std::shared_ptr<Scope> scope);
+  // JS thread only. Returns the recycled scope once, nullptr otherwise.
+  std::shared_ptr<Scope> TakeRecycledScope();
   void Enter();
   void Exit();
   std::shared_ptr<Scope> CreateScope(
       const std::string& name = "",
       std::unique_ptr<RegisterMap> map = std::unique_ptr<RegisterMap>());
   inline std::shared_ptr<VM> GetVM() { return vm_; }
+  // Holds kIsolateCreation, scopes copy it when they are initialized.
+  inline hippy::base::StartupTimeline& GetStartupTimeline() { return startup_timeline_; }
+
+  // Must be called before AsyncInit.
+  inline void SetThreadConfig(const ThreadConfig& config) { thread_config_ = config; }
+  // Restores the JS thread scheduling parameters changed by the startup boost.
+  void EndStartupBoost();
 
   void TerminateRunner();
   inline std::shared_ptr<JavaScriptTaskRunner> GetJSRunner() {
@@ -76,6 +115,8 @@ class Engine: public std::enable_shared_from_this<Engine> {
  private:
   void SetupThreads();
   void CreateVM(const std::shared_ptr<VMInitParam>& param);
+  void RunVMCreatedCallback();
+  void BeginStartupBoost();
 
  private:
   static const uint32_t kDefaultWorkerPoolSize;
@@ -83,9 +124,18 @@ class Engine: public std::enable_shared_from_this<Engine> {
   std::shared_ptr<JavaScriptTaskRunner> js_runner_;
   std::shared_ptr<WorkerTaskRunner> worker_task_runner_;
   std::shared_ptr<VM> vm_;
+  // Only touched on the JS thread.
+  std::shared_ptr<hippy::napi::Ctx> warm_context_;
+  // Only touched on the JS thread.
+  std::shared_ptr<Scope> recycled_scope_;
   std::unique_ptr<RegisterMap> map_;
   std::mutex cnt_mutex_;
   uint32_t scope_cnt_;
+  ThreadConfig thread_config_;
+  hippy::base::StartupTimeline startup_timeline_;
+  // Only touched on the JS thread.
+  bool is_startup_boosted_ = false;
+  SchedulingParams params_before_boost_;
 #if defined(JS_V8) && !defined(V8_WITHOUT_INSPECTOR)
   std::shared_ptr<hippy::inspector::V8InspectorClientImpl> inspector_client_;
 #endif
@@ -0,0 +1,96 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>  // NOLINT(build/c++11)
+
+#include "core/engine.h"
+#include "core/task/worker_task_runner.h"
+
+// Keeps engines warmed up ahead of time, i.e. with their threads started, the
+// VM created and a context ready, so that opening a page does not pay for it.
+// Engines are created on a worker of SharedWorkerPool and warm up on their own
+// JS threads.
+class EnginePool : public std::enable_shared_from_this<EnginePool> {
+ public:
+  struct Config {
+    // Number of engines kept warm.
+    uint32_t capacity = 1;
+    // No engine is added while the idle engines would use more JS heap than
+    // this in total, 0 for no limit. Sizes are known once the first engine
+    // is warm, until then only capacity applies.
+    size_t max_heap_size_in_bytes = 0;
+    Engine::ThreadConfig thread_config;
+    std::shared_ptr<hippy::napi::VMInitParam> vm_init_param;
+  };
+
+  explicit EnginePool(const Config& config);
+  ~EnginePool();
+
+  EnginePool(const EnginePool&) = delete;
+  EnginePool& operator=(const EnginePool&) = delete;
+
+  // Warms engines in the background until the pool is full again.
+  void Refill();
+  // Takes the oldest idle engine and starts a refill. The engine may still be
+  // warming up, its JS runner finishes that before anything the caller posts.
+  // The caller hands its callbacks over with Engine::Adopt. Returns nullptr
+  // when the pool is empty, the caller creates an engine as usual then.
+  std::shared_ptr<Engine> Acquire();
+  // Terminates the idle engines, e.g. under memory pressure. The pool stays
+  // empty until the next Refill or Acquire.
+  void Trim();
+
+  size_t GetIdleCount();
+  // Measured once every engine is warm, estimated before.
+  size_t GetIdleHeapSize();
+
+ private:
+  struct Entry {
+    std::shared_ptr<Engine> engine;
+    // Written on the JS thread once the engine is warm, 0 before.
+    std::shared_ptr<std::atomic<size_t>> heap_size;
+  };
+
+  void RunRefill(uint32_t trim_count);
+  // mutex_ must be held.
+  bool IsFull();
+  size_t GetIdleHeapSizeLocked();
+
+  Config config_;
+  std::shared_ptr<WorkerTaskRunner> refill_runner_;
+  std::mutex mutex_;
+  std::deque<Entry> idle_;
+  // Last measured heap size of a warm engine, stands in for the ones that
+  // are still warming up.
+  size_t heap_size_estimate_ = 0;
+  // Bumped by Trim so that a running refill stops.
+  uint32_t trim_count_ = 0;
+  bool is_refilling_ = false;
+};
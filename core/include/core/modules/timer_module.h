@@ -44,26 +44,29 @@ class TimerModule : public ModuleBase {
   void ClearTimeout(const hippy::napi::CallbackInfo& info);
   void SetInterval(const hippy::napi::CallbackInfo& info);
   void ClearInterval(const hippy::napi::CallbackInfo& info);
+  void RequestIdleCallback(const hippy::napi::CallbackInfo& info);
+  void CancelIdleCallback(const hippy::napi::CallbackInfo& info);
 
  private:
   using TaskId = hippy::base::Task::TaskId;
   using CtxValue = hippy::napi::CtxValue;
   using Ctx = hippy::napi::Ctx;
 
-  std::shared_ptr<CtxValue> Start(const hippy::napi::CallbackInfo& info,
-                                  bool repeat);
-  void RemoveTask(const std::shared_ptr<JavaScriptTask>& task);
+  hippy::napi::CtxLocalValue Start(const hippy::napi::CallbackInfo& info,
+                                   bool repeat);
+  void RemoveTask(const std::shared_ptr<hippy::base::Task>& task);
   void Cancel(TaskId task_id, const std::shared_ptr<Scope>& scope);
 
   struct TaskEntry {
     TaskEntry(std::shared_ptr<CtxValue> func,
-              std::weak_ptr<JavaScriptTask> task): func(func), task(task) {}
+              std::weak_ptr<hippy::base::Task> task): func(func), task(task) {}
 
     std::shared_ptr<CtxValue> func;
-    std::weak_ptr<JavaScriptTask> task;
+    std::weak_ptr<hippy::base::Task> task;
   };
 
   std::unordered_map<TaskId, std::shared_ptr<TaskEntry>> task_map_;
+  std::weak_ptr<JavaScriptTaskRunner> runner_;
 
   static const int kTimerInvalidId = 0;
 };
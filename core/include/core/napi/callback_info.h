@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <vector>
 
@@ -39,12 +40,24 @@ class ReturnValue {
   ReturnValue(const ReturnValue &) = delete;
   ReturnValue &operator=(const ReturnValue &) = delete;
 
-  void SetUndefined() { value_ = nullptr; }
-  void Set(std::shared_ptr<CtxValue> value) { value_ = value; }
+  void SetUndefined() {
+    value_ = nullptr;
+    local_value_ = CtxLocalValue();
+  }
+  void Set(std::shared_ptr<CtxValue> value) {
+    value_ = value;
+    local_value_ = CtxLocalValue();
+  }
+  void SetLocal(CtxLocalValue value) {
+    value_ = nullptr;
+    local_value_ = value;
+  }
   std::shared_ptr<CtxValue> Get() const { return value_; }
+  CtxLocalValue GetLocal() const { return local_value_; }
 
  private:
   std::shared_ptr<CtxValue> value_;
+  CtxLocalValue local_value_;
 };
 
 class ExceptionValue {
@@ -70,18 +83,28 @@ class CallbackInfo {
   CallbackInfo &operator=(const CallbackInfo &) = delete;
 
   void AddValue(const std::shared_ptr<CtxValue>& value);
+  void AddLocalValue(CtxLocalValue value);
+  // Values added with AddLocalValue are globalized on first access.
   std::shared_ptr<CtxValue> operator[](size_t index) const;
+  // Empty for values added with AddValue and out of range indexes.
+  CtxLocalValue GetLocalValue(size_t index) const;
 
-  size_t Length() const { return values_.size(); }
+  size_t Length() const { return length_; }
   std::shared_ptr<Scope> GetScope() const { return scope_; }
-  ReturnValue* GetReturnValue() const { return ret_value_.get(); }
-  ExceptionValue* GetExceptionValue() const { return exception_value_.get(); }
+  ReturnValue* GetReturnValue() const { return &ret_value_; }
+  ExceptionValue* GetExceptionValue() const { return &exception_value_; }
 
  private:
+  // Most callbacks take a few arguments, they need no allocation.
+  static constexpr size_t kInlineLocalValueCount = 4;
+
   std::shared_ptr<Scope> scope_;
-  std::vector<std::shared_ptr<CtxValue>> values_;
-  std::unique_ptr<ReturnValue> ret_value_;
-  std::unique_ptr<ExceptionValue> exception_value_;
+  size_t length_ = 0;
+  std::array<CtxLocalValue, kInlineLocalValueCount> inline_local_values_;
+  std::vector<CtxLocalValue> local_values_;
+  mutable std::vector<std::shared_ptr<CtxValue>> values_;
+  mutable ReturnValue ret_value_;
+  mutable ExceptionValue exception_value_;
 };
 
 }  // namespace napi
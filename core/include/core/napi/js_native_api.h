@@ -34,7 +34,10 @@ namespace napi {
 
 std::shared_ptr<CtxValue> GetInternalBindingFn(const std::shared_ptr<Scope>& scope);
 
-std::shared_ptr<VM> CreateVM(const std::shared_ptr<VMInitParam>& param);
+// A thread shared VM is only used under a lock, from its creation on, and may
+// be entered on different threads, see VM::EnterThread.
+std::shared_ptr<VM> CreateVM(const std::shared_ptr<VMInitParam>& param,
+                             bool is_thread_shared = false);
 
 std::shared_ptr<TryCatch> CreateTryCatchScope(bool enable,
                                               std::shared_ptr<Ctx> ctx);
@@ -75,6 +75,22 @@ class CtxValue {
   virtual ~CtxValue() {}
 };
 
+// A JS value held by the engine's innermost handle scope, e.g. the one of the
+// native callback that got it, see CallbackInfo::GetLocalValue. It is copied
+// like a pointer and must not be used once that scope is gone;
+// Ctx::GlobalizeLocal keeps a value for longer.
+class CtxLocalValue {
+ public:
+  CtxLocalValue() = default;
+  explicit CtxLocalValue(void* ref) : ref_(ref) {}
+
+  bool IsEmpty() const { return ref_ == nullptr; }
+  void* Get() const { return ref_; }
+
+ private:
+  void* ref_ = nullptr;
+};
+
 class Ctx {
  public:
   using JSValueWrapper = hippy::base::JSValueWrapper;
@@ -171,6 +187,10 @@ class Ctx {
       const unicode_string_view& file_name) = 0;
   virtual std::shared_ptr<CtxValue> GetJsFn(
       const unicode_string_view& name) = 0;
+  // Function the native source `name` evaluates to when the context comes
+  // from a startup snapshot that holds it compiled, nullptr otherwise.
+  virtual std::shared_ptr<CtxValue> GetNativeSourceFunction(
+      const unicode_string_view& name) { return nullptr; }
 
   virtual void ThrowException(const std::shared_ptr<CtxValue> &exception) = 0;
   virtual void ThrowException(const unicode_string_view& exception) = 0;
@@ -180,6 +200,19 @@ class Ctx {
       const std::shared_ptr<CtxValue>& value) = 0;
   virtual std::shared_ptr<CtxValue> CreateCtxValue(
       const std::shared_ptr<JSValueWrapper>& wrapper) = 0;
+
+  // Local Value Helpers, only while a native callback runs
+  virtual CtxLocalValue CreateNumberLocal(double number) = 0;
+  virtual CtxLocalValue CreateBooleanLocal(bool b) = 0;
+  virtual CtxLocalValue CreateStringLocal(const unicode_string_view& string) = 0;
+  virtual bool GetValueNumber(CtxLocalValue value, double* result) = 0;
+  virtual bool GetValueNumber(CtxLocalValue value, int32_t* result) = 0;
+  virtual bool GetValueBoolean(CtxLocalValue value, bool* result) = 0;
+  virtual bool GetValueString(CtxLocalValue value,
+                              unicode_string_view* result) = 0;
+  virtual bool IsNullOrUndefined(CtxLocalValue value) = 0;
+  virtual bool IsFunction(CtxLocalValue value) = 0;
+  virtual std::shared_ptr<CtxValue> GlobalizeLocal(CtxLocalValue value) = 0;
 };
 
 struct VMInitParam {};
@@ -190,6 +223,16 @@ class VM {
   virtual ~VM() { TDF_BASE_DLOG(INFO) << "~VM"; }
 
   virtual std::shared_ptr<Ctx> CreateContext() = 0;
+
+  // A VM starts out entered on the thread that created it. VMs of engines
+  // sharing JS threads are exited whenever their tasks yield the thread and
+  // entered again, possibly on another thread, before their next task runs.
+  virtual void EnterThread() {}
+  virtual void ExitThread() {}
+
+  // Bytes currently used by the JS heap, 0 when the VM can not tell. Must be
+  // called on the JS thread.
+  virtual size_t GetUsedHeapSize() { return 0; }
 };
 
 class TryCatch {
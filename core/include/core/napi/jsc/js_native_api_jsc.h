@@ -195,6 +195,19 @@ class JSCCtx : public Ctx {
   virtual std::shared_ptr<CtxValue> CreateCtxValue(
       const std::shared_ptr<JSValueWrapper>& wrapper) override;
 
+  virtual CtxLocalValue CreateNumberLocal(double number) override;
+  virtual CtxLocalValue CreateBooleanLocal(bool b) override;
+  virtual CtxLocalValue CreateStringLocal(
+      const unicode_string_view& string) override;
+  virtual bool GetValueNumber(CtxLocalValue value, double* result) override;
+  virtual bool GetValueNumber(CtxLocalValue value, int32_t* result) override;
+  virtual bool GetValueBoolean(CtxLocalValue value, bool* result) override;
+  virtual bool GetValueString(CtxLocalValue value,
+                              unicode_string_view* result) override;
+  virtual bool IsNullOrUndefined(CtxLocalValue value) override;
+  virtual bool IsFunction(CtxLocalValue value) override;
+  virtual std::shared_ptr<CtxValue> GlobalizeLocal(CtxLocalValue value) override;
+
   unicode_string_view GetExceptionMsg(const std::shared_ptr<CtxValue>& exception);
   JSStringRef CreateJSCString(const unicode_string_view& str_view);
 
@@ -203,6 +216,15 @@ class JSCCtx : public Ctx {
   bool is_exception_handled_;
 };
 
+// JSC keeps the values on the stack alive, a CtxLocalValue is a JSValueRef.
+inline CtxLocalValue ToCtxLocalValue(JSValueRef value) {
+  return CtxLocalValue(const_cast<OpaqueJSValue*>(value));
+}
+
+inline JSValueRef ToJSValueRef(CtxLocalValue value) {
+  return reinterpret_cast<JSValueRef>(value.Get());
+}
+
 inline tdf::base::unicode_string_view ToStrView(JSStringRef str) {
   return tdf::base::unicode_string_view(
       reinterpret_cast<const char16_t*>(JSStringGetCharactersPtr(str)),
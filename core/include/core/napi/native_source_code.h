@@ -26,6 +26,7 @@
 #include <stdint.h>
 
 #include <string>
+#include <vector>
 
 namespace hippy {
 
@@ -35,5 +36,6 @@ struct NativeSourceCode {
 };
 
 const NativeSourceCode GetNativeSourceCode(const std::string& filename);
+std::vector<std::string> GetNativeSourceCodeNames();
 
 }  // namespace hippy
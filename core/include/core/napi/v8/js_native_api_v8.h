@@ -23,9 +23,13 @@
 #pragma once
 
 #include <stdint.h>
+#include <string.h>
 
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "base/logging.h"
@@ -33,11 +37,13 @@
 #include "core/base/common.h"
 #include "core/base/js_value_wrapper.h"
 #include "core/base/macros.h"
+#include "core/base/startup_timeline.h"
 #include "core/modules/module_base.h"
 #include "core/napi/callback_info.h"
 #include "core/napi/js_native_api.h"
 #include "core/napi/js_native_api_types.h"
 #include "core/napi/native_source_code.h"
+#include "core/napi/v8/script_streamer_v8.h"
 #include "core/scope.h"
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wconversion"
@@ -48,14 +54,54 @@ namespace hippy {
 namespace napi {
 
 void JsCallbackFunc(const v8::FunctionCallbackInfo<v8::Value>& info);
+void BindingCallbackFunc(const v8::FunctionCallbackInfo<v8::Value>& info);
 void NativeCallbackFunc(const v8::FunctionCallbackInfo<v8::Value>& info);
 void GetInternalBinding(const v8::FunctionCallbackInfo<v8::Value>& info);
 
+// Templates of the internal binding modules, built once per isolate and
+// shared by all of its contexts. Their functions find the scope through the
+// BindingData of the calling context, see V8VM::kBindingDataIndex.
+struct BindingTemplates {
+  using unicode_string_view = tdf::base::unicode_string_view;
+
+  void Reset();
+
+  v8::Global<v8::FunctionTemplate> internal_binding;
+  std::unordered_map<unicode_string_view, v8::Global<v8::FunctionTemplate>> modules;
+  // Data of the module function templates.
+  std::vector<std::unique_ptr<JsCallback>> callbacks;
+};
+
+// Internalized strings of the names native code uses over and over, e.g.
+// "hippyBridge", module and method names, shared by the contexts of an
+// isolate. A name is cached on its first use while the cache holds fewer
+// than kMaxSize names, since its handle lives as long as the isolate.
+class V8NameCache {
+ public:
+  using unicode_string_view = tdf::base::unicode_string_view;
+
+  explicit V8NameCache(v8::Isolate* isolate) : isolate_(isolate) {}
+
+  void RegisterNames(const std::vector<unicode_string_view>& names);
+  // In the caller's HandleScope.
+  v8::Local<v8::String> Get(const unicode_string_view& name);
+
+  static constexpr size_t kMaxSize = 512;
+
+ private:
+  v8::Isolate* isolate_;
+  std::unordered_map<unicode_string_view, v8::Eternal<v8::String>> names_;
+};
+
 struct V8VMInitParam: public VMInitParam {
   size_t initial_heap_size_in_bytes;
   size_t maximum_heap_size_in_bytes;
   v8::NearHeapLimitCallback near_heap_limit_callback;
   void* near_heap_limit_callback_data;
+  // Made by V8VM::CreateSnapshot with the same V8 build and flags, on Android
+  // with the snapshot_generator tool. Null to start from the snapshot built
+  // into V8.
+  std::shared_ptr<const std::string> snapshot_blob;
 
   static size_t HeapLimitSlowGrowthStrategy(void* data, size_t current_heap_limit,
                                             size_t initial_heap_limit) {
@@ -85,14 +131,51 @@ struct V8VMInitParam: public VMInitParam {
 
 class V8VM : public VM {
  public:
-  V8VM(const std::shared_ptr<V8VMInitParam>& param);
+  V8VM(const std::shared_ptr<V8VMInitParam>& param, bool is_thread_shared = false);
   ~V8VM();
 
   virtual std::shared_ptr<Ctx> CreateContext();
+  virtual void EnterThread();
+  virtual void ExitThread();
+  virtual size_t GetUsedHeapSize();
+  static void InitializePlatform();
+  // Changes with the V8 version and flags, code caches of another tag are
+  // useless.
+  static std::string GetCodeCacheTag();
   static void PlatformDestroy();
+  // Caches names up front, see V8NameCache. Must be called on the JS thread.
+  void RegisterNames(const std::vector<tdf::base::unicode_string_view>& names);
+
+  // Startup snapshot whose context already holds every native source, the
+  // bootstrap included, compiled to the function it evaluates to. Contexts of
+  // a VM created from it skip parsing and compiling them. Returns an empty
+  // blob on failure.
+  static std::string CreateSnapshot();
+  // Native callbacks a snapshot may refer to, null terminated.
+  static const intptr_t* GetExternalReferences();
+
+  static constexpr size_t kSnapshotContextIndex = 0;
+  static constexpr size_t kNativeSourceFunctionsIndex = 0;
+  // Isolate data slot of the BindingTemplates, slot 0 belongs to the embedder.
+  static constexpr uint32_t kBindingTemplatesSlotIndex = 1;
+  // Isolate data slot of the V8NameCache.
+  static constexpr uint32_t kNameCacheSlotIndex = 2;
+  // Context embedder data index of the scope's BindingData, clear of the low
+  // indices V8's debugger and inspector use.
+  static constexpr int kBindingDataIndex = 32;
 
   v8::Isolate* isolate_;
   v8::Isolate::CreateParams create_params_;
+  // Must outlive the isolate, contexts are deserialized from it on demand.
+  std::shared_ptr<const std::string> snapshot_blob_;
+  v8::StartupData snapshot_data_;
+  // Locked from the constructor on, see hippy::napi::CreateVM.
+  bool is_thread_shared_;
+  bool is_entered_ = false;
+  // Held between EnterThread and ExitThread.
+  std::unique_ptr<v8::Locker> locker_;
+  std::unique_ptr<BindingTemplates> binding_templates_;
+  std::unique_ptr<V8NameCache> name_cache_;
 
  public:
   static std::unique_ptr<v8::Platform> platform_;
@@ -136,22 +219,34 @@ class CBDataTuple {
   const v8::FunctionCallbackInfo<v8::Value>& info_;
 };
 
+// A CtxLocalValue holds the slot a v8::Local points to, like napi_value in
+// Node-API does.
+inline CtxLocalValue ToCtxLocalValue(v8::Local<v8::Value> local) {
+  static_assert(sizeof(local) == sizeof(void*), "v8::Local must be a pointer");
+  void* ref = nullptr;
+  memcpy(&ref, &local, sizeof(local));
+  return CtxLocalValue(ref);
+}
+
+inline v8::Local<v8::Value> ToV8LocalValue(CtxLocalValue value) {
+  v8::Local<v8::Value> local;
+  void* ref = value.Get();
+  memcpy(static_cast<void*>(&local), &ref, sizeof(ref));
+  return local;
+}
+
 class V8Ctx : public Ctx {
  public:
   using unicode_string_view = tdf::base::unicode_string_view;
   using JSValueWrapper = hippy::base::JSValueWrapper;
 
-  explicit V8Ctx(v8::Isolate* isolate) : isolate_(isolate) {
-    v8::HandleScope handle_scope(isolate);
-
-    v8::Local<v8::ObjectTemplate> global = v8::ObjectTemplate::New(isolate);
-    v8::Local<v8::Context> context = v8::Context::New(isolate, nullptr, global);
-
-    global_persistent_.Reset(isolate, global);
-    context_persistent_.Reset(isolate, context);
-  }
+  explicit V8Ctx(v8::Isolate* isolate, bool from_snapshot = false);
 
   ~V8Ctx() {
+    native_source_functions_.Reset();
+    for (auto& it : deferred_scripts_) {
+      it.second.Reset();
+    }
     context_persistent_.Reset();
     global_persistent_.Reset();
   }
@@ -252,8 +347,55 @@ class V8Ctx : public Ctx {
       bool is_use_code_cache,
       unicode_string_view* cache,
       bool is_copy);
+  // Asks RunScriptWithCodeCache and RunStreamedScript for a code cache when
+  // the script compiled without an accepted one.
+  struct CodeCacheRequest {
+    // kAfterExecution keeps the script for CreateDeferredCodeCache, to be
+    // called once the functions it compiles lazily have run, so that the
+    // cache includes them.
+    enum class Timing { kAfterCompile, kAfterExecution };
+
+    Timing timing = Timing::kAfterCompile;
+    // Results.
+    bool is_needed = false;
+    std::string code_cache;  // kAfterCompile
+    uint32_t deferred_script_id = 0;  // kAfterExecution
+  };
+
+  // Compiles with code_cache when the engine accepts it.
+  std::shared_ptr<CtxValue> RunScriptWithCodeCache(
+      const unicode_string_view& data,
+      const unicode_string_view& file_name,
+      const uint8_t* code_cache,
+      size_t code_cache_length,
+      CodeCacheRequest* code_cache_request);
+  // Finishes a script compiled by streamer and runs it, streamer must have
+  // been finished.
+  std::shared_ptr<CtxValue> RunStreamedScript(
+      const std::shared_ptr<V8ScriptStreamer>& streamer,
+      const unicode_string_view& file_name,
+      CodeCacheRequest* code_cache_request);
+  // Creates the code cache of a script kept by a kAfterExecution request and
+  // releases the script, returns an empty string if there is none.
+  std::string CreateDeferredCodeCache(uint32_t deferred_script_id);
+  // Remembers the own properties of the global object, e.g. right after
+  // bootstrap, for DeleteGlobalsAddedSinceSave.
+  void SaveGlobalNames();
+  inline bool HasSavedGlobalNames() const { return has_saved_global_names_; }
+  // Deletes the own properties of the global object that were not there in
+  // SaveGlobalNames, or sets them to undefined when they cannot be deleted,
+  // e.g. top level var declarations. Top level let and const bindings of
+  // scripts are not properties and stay.
+  void DeleteGlobalsAddedSinceSave();
+  // Receives kCompile and kFirstScriptRun of RunScriptWithCodeCache and
+  // RunStreamedScript.
+  inline void SetStartupTimeline(std::shared_ptr<hippy::base::StartupTimeline> timeline) {
+    startup_timeline_ = std::move(timeline);
+  }
 
   virtual std::shared_ptr<CtxValue> GetJsFn(const unicode_string_view& name) override;
+  virtual std::shared_ptr<CtxValue> GetNativeSourceFunction(
+      const unicode_string_view& name) override;
   virtual void ThrowException(const std::shared_ptr<CtxValue>& exception) override;
   virtual void ThrowException(const unicode_string_view& exception) override;
   virtual void HandleUncaughtException(const std::shared_ptr<CtxValue>& exception) override;
@@ -263,24 +405,61 @@ class V8Ctx : public Ctx {
   virtual std::shared_ptr<CtxValue> CreateCtxValue(
       const std::shared_ptr<JSValueWrapper>& wrapper) override;
 
+  virtual CtxLocalValue CreateNumberLocal(double number) override;
+  virtual CtxLocalValue CreateBooleanLocal(bool b) override;
+  virtual CtxLocalValue CreateStringLocal(
+      const unicode_string_view& string) override;
+  virtual bool GetValueNumber(CtxLocalValue value, double* result) override;
+  virtual bool GetValueNumber(CtxLocalValue value, int32_t* result) override;
+  virtual bool GetValueBoolean(CtxLocalValue value, bool* result) override;
+  virtual bool GetValueString(CtxLocalValue value,
+                              unicode_string_view* result) override;
+  virtual bool IsNullOrUndefined(CtxLocalValue value) override;
+  virtual bool IsFunction(CtxLocalValue value) override;
+  virtual std::shared_ptr<CtxValue> GlobalizeLocal(CtxLocalValue value) override;
+
   unicode_string_view ToStringView(v8::Local<v8::String> str) const;
   unicode_string_view GetMsgDesc(v8::Local<v8::Message> message);
   unicode_string_view GetStackInfo(v8::Local<v8::Message> message) const;
   unicode_string_view GetStackTrace(v8::Local<v8::StackTrace> trace) const;
   v8::Local<v8::String> CreateV8String(const unicode_string_view& string) const;
+  // Internalized once per isolate, for property and function names.
+  v8::Local<v8::String> CreateV8Name(const unicode_string_view& name) const;
+  // Convert a whole value tree in one pass, in the caller's HandleScope and
+  // context. Fail on values JSValueWrapper can not hold.
+  bool ConvertV8Value(v8::Local<v8::Context> context,
+                      v8::Local<v8::Value> value,
+                      JSValueWrapper* result);
+  v8::MaybeLocal<v8::Value> CreateV8Value(v8::Local<v8::Context> context,
+                                          const JSValueWrapper& wrapper);
 
   v8::Isolate* isolate_;
   v8::Persistent<v8::ObjectTemplate> global_persistent_;
   v8::Persistent<v8::Context> context_persistent_;
+  // Empty unless the context comes from V8VM::CreateSnapshot.
+  v8::Persistent<v8::Object> native_source_functions_;
   std::unique_ptr<CBTuple> data_tuple_;
 
  private:
+  v8::ScriptOrigin CreateScriptOrigin(const unicode_string_view& file_name) const;
+  v8::MaybeLocal<v8::String> CreateSourceString(const unicode_string_view& str_view,
+                                                bool is_copy) const;
+  void FulfillCodeCacheRequest(v8::Local<v8::Script> script, CodeCacheRequest* request);
+  std::string CreateCodeCache(v8::Local<v8::UnboundScript> unbound_script);
+  std::shared_ptr<CtxValue> RunCompiledScript(v8::Local<v8::Context> context,
+                                              v8::Local<v8::Script> script);
   std::shared_ptr<CtxValue> InternalRunScript(
       v8::Local<v8::Context> context,
       v8::Local<v8::String> source,
       const unicode_string_view& file_name,
       bool is_use_code_cache,
       unicode_string_view* cache);
+
+  std::unordered_map<uint32_t, v8::Global<v8::UnboundScript>> deferred_scripts_;
+  uint32_t next_deferred_script_id_ = 1;
+  std::shared_ptr<hippy::base::StartupTimeline> startup_timeline_;
+  std::unordered_set<std::string> saved_global_names_;
+  bool has_saved_global_names_ = false;
 };
 
 struct V8CtxValue : public CtxValue {
@@ -0,0 +1,110 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <condition_variable>  // NOLINT(build/c++11)
+#include <deque>
+#include <memory>
+#include <mutex>  // NOLINT(build/c++11)
+#include <utility>
+
+#include "base/unicode_string_view.h"
+#include "core/base/thread.h"
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wconversion"
+#include "v8/v8.h"
+#pragma clang diagnostic pop
+
+namespace hippy {
+namespace napi {
+
+// Parses and compiles a UTF-8 script with V8's streaming compiler while its
+// source is still being read. Created on the JS thread, fed from any thread,
+// compiled on a thread of its own and finished on the JS thread by
+// V8Ctx::RunStreamedScript.
+class V8ScriptStreamer {
+ public:
+  using unicode_string_view = tdf::base::unicode_string_view;
+  using u8string = unicode_string_view::u8string;
+  using char8_t_ = unicode_string_view::char8_t_;
+
+  explicit V8ScriptStreamer(v8::Isolate* isolate);
+  ~V8ScriptStreamer();
+
+  V8ScriptStreamer(const V8ScriptStreamer&) = delete;
+  V8ScriptStreamer& operator=(const V8ScriptStreamer&) = delete;
+
+  void AddChunk(const char8_t_* data, size_t length);
+  // No more chunks, the compile task finishes with what it got.
+  void Finish();
+  // Drops the compile task unless it already runs, e.g. when reading fails.
+  void Cancel();
+  // Starts the compile task on a thread of its own. V8's parser blocks it
+  // until the last chunk, it would hold a pooled worker for the whole read.
+  void StartCompileThread();
+
+  // JS thread, after Finish. Waits for the compile task, running it here if
+  // it has not started yet, and finalizes the script. Only call once.
+  v8::MaybeLocal<v8::Script> Compile(v8::Local<v8::Context> context,
+                                     const v8::ScriptOrigin& origin);
+  // Length of the source read so far, complete after Finish.
+  size_t GetSourceLength() const { return source_.length(); }
+
+ private:
+  class ChunkedSourceStream;
+
+  class CompileThread : public hippy::base::Thread {
+   public:
+    explicit CompileThread(V8ScriptStreamer* streamer)
+        : Thread(Options("hippy.compile")), streamer_(streamer) {}
+
+    void Run() override { streamer_->RunCompileTask(); }
+
+   private:
+    V8ScriptStreamer* streamer_;
+  };
+
+  enum class TaskState { kPending, kRunning, kDone };
+
+  // Returns at once when the task has been run or cancelled already.
+  void RunCompileTask();
+
+  v8::Isolate* isolate_;
+  // Owned by streamed_source_.
+  ChunkedSourceStream* stream_;
+  std::unique_ptr<v8::ScriptCompiler::StreamedSource> streamed_source_;
+  std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask> task_;
+  std::unique_ptr<CompileThread> compile_thread_;
+  // V8 owns the chunks it parses, this copy becomes the script source.
+  u8string source_;
+  bool is_one_byte_ = true;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  TaskState task_state_ = TaskState::kPending;
+};
+
+}  // namespace napi
+}  // namespace hippy
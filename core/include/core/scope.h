@@ -26,6 +26,9 @@
 #include <unordered_map>
 
 #include "base/unicode_string_view.h"
+#include "core/base/async.h"
+#include "core/base/code_cache_store.h"
+#include "core/base/startup_timeline.h"
 #include "core/base/common.h"
 #include "core/base/task.h"
 #include "core/base/uri_loader.h"
@@ -53,6 +56,8 @@ class Scope {
   using CtxValue = hippy::napi::CtxValue;
   using Ctx = hippy::napi::Ctx;
   using UriLoader = hippy::base::UriLoader;
+  using CodeCacheStore = hippy::base::CodeCacheStore;
+  using StartupTimeline = hippy::base::StartupTimeline;
   using FunctionData = hippy::napi::FunctionData;
   using BindingData = hippy::napi::BindingData;
   using Encoding = hippy::napi::Encoding;
@@ -88,10 +93,28 @@ class Scope {
              const unicode_string_view& name,
              bool is_copy = true);
 
+  // JS thread only. Ends the page like WillExit and brings the context back
+  // to the state bootstrap left it in: module instances go, which cancels
+  // their timers, and so do globals added since. Engine::KeepRecycledScope
+  // then hands the context to the next scope of the engine, which skips
+  // global module registration and bootstrap. Returns false when the context
+  // cannot be recycled.
+  bool Recycle();
+  // Set by Recycle, pending callbacks of the old page must not run.
+  inline bool IsRecycled() const { return is_recycled_; }
+
   std::shared_ptr<CtxValue> RunJSSync(const unicode_string_view& data,
                                       const unicode_string_view& name,
                                       bool is_copy = true);
 
+#if defined(ENABLE_COROUTINE)
+  // Same as RunJSSync without blocking the caller, the awaiting coroutine
+  // resumes on the JS thread. The context, the runner and a copy of the
+  // source are taken at the call, the source is always copied into V8.
+  hippy::base::Async<std::shared_ptr<CtxValue>> RunJSAsync(const unicode_string_view& data,
+                                                           const unicode_string_view& name);
+#endif
+
   inline std::shared_ptr<JavaScriptTaskRunner> GetTaskRunner() {
     return engine_->GetJSRunner();
   }
@@ -113,9 +136,23 @@ class Scope {
 
   inline std::shared_ptr<UriLoader> GetUriLoader() { return loader_; }
 
+  // Store of the main bundle's code cache, also used by chunks loaded later.
+  // JS thread only.
+  inline void SetCodeCacheStore(std::shared_ptr<CodeCacheStore> store) {
+    code_cache_store_ = store;
+  }
+
+  inline std::shared_ptr<CodeCacheStore> GetCodeCacheStore() { return code_cache_store_; }
+
+  // Startup phases of this scope, including those of its engine and process
+  // recorded before it was initialized.
+  inline StartupTimeline& GetStartupTimeline() { return *startup_timeline_; }
+
  private:
   friend class Engine;
   void Initialized();
+  bool Bootstrap(const std::shared_ptr<Scope>& self);
+  void AdoptRecycledScope(Scope* recycled, const std::shared_ptr<Scope>& self);
 
  private:
   Engine* engine_;
@@ -130,4 +167,8 @@ class Scope {
   std::unique_ptr<BindingData> binding_data_;
   std::unique_ptr<ScopeWrapper> wrapper_;
   std::shared_ptr<UriLoader> loader_;
+  std::shared_ptr<CodeCacheStore> code_cache_store_;
+  // Shared with the context, which records compile and run phases.
+  std::shared_ptr<StartupTimeline> startup_timeline_ = std::make_shared<StartupTimeline>();
+  bool is_recycled_ = false;
 };
@@ -29,6 +29,7 @@
 class CommonTask : public hippy::base::Task {
  public:
   void Run() override;
+  void OnCanceled() override;
   virtual inline bool isPriorityTask() override { return false; }
   std::function<void()> func_;
 };
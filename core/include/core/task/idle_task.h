@@ -0,0 +1,53 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <functional>
+
+#include "core/base/task.h"
+
+// Low priority task run by JavaScriptTaskRunner only when nothing else is
+// queued, within the time left in the current frame.
+class IdleTask : public hippy::base::Task {
+ public:
+  struct Deadline {
+    uint64_t time_remaining_in_ms;
+    bool did_timeout;
+  };
+
+  bool isPriorityTask() override;
+  void Run() override;
+  void OnCanceled() override;
+
+  using Function = std::function<void(const Deadline&)>;
+  Function callback = nullptr;
+
+ private:
+  friend class JavaScriptTaskRunner;
+
+  Deadline deadline_{0, false};
+  // 0 means the task waits for idle time forever.
+  uint64_t timeout_time_ = 0;
+};
@@ -30,6 +30,7 @@ class JavaScriptTask : public hippy::base::Task {
  public:
   bool isPriorityTask() override;
   void Run() override;
+  void OnCanceled() override;
 
   using Function = std::function<void()>;
   Function callback = nullptr;
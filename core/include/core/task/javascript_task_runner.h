@@ -22,21 +22,122 @@
 
 #pragma once
 
-#include "core/base/task_runner.h"
 #include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "core/base/task_runner.h"
+#include "core/task/idle_task.h"
+
+class JavaScriptThreadPool;
 
 class JavaScriptTaskRunner : public hippy::base::TaskRunner {
  public:
-  JavaScriptTaskRunner();
-  ~JavaScriptTaskRunner() = default;
+  using Task = hippy::base::Task;
+
+  // Durations are in microseconds and describe the last finished frame.
+  struct FrameStats {
+    uint64_t frame_count = 0;
+    uint64_t over_budget_frame_count = 0;
+    uint64_t frame_budget_in_us = 0;
+    uint64_t animation_time_in_us = 0;
+    uint64_t task_time_in_us = 0;
+    uint64_t idle_time_in_us = 0;
+  };
+
+  explicit JavaScriptTaskRunner(const SchedulingParams& params = {});
+  // Runner without a thread of its own, its tasks run in slices on the
+  // threads of `pool`. Start must not be called.
+  explicit JavaScriptTaskRunner(std::shared_ptr<JavaScriptThreadPool> pool);
+  ~JavaScriptTaskRunner();
+
+  void Run() override;
+  // Runs the tasks already queued before returning, like for a runner with
+  // its own thread.
+  void Terminate() override;
+
+  // Called on the pool thread around every slice of a pooled runner, the
+  // engine enters and exits its VM there.
+  void SetSliceCallbacks(std::function<void()> on_enter, std::function<void()> on_exit);
 
  public:
   bool IsJsThread();
 
+ public:
+  // Frame scheduling. The host signals vsyncs with a frame time on the
+  // MonotonicallyIncreasingTime clock, the Android host does so for every
+  // frame that resolves a requestAnimationFrame. Animation frame callbacks run
+  // at the start of the next frame before any queued task, idle tasks only
+  // run when the queue is empty and there is time left in the frame. All of
+  // these can be called from any thread.
+  void OnVsync(DelayedTimeInMs frame_time, DelayedTimeInMs frame_interval);
+  void RequestAnimationFrame(std::shared_ptr<Task> task);
+  void PostIdleTask(std::shared_ptr<IdleTask> task, DelayedTimeInMs timeout = 0);
+  FrameStats GetFrameStats();
+
  public:
   void PauseThreadForInspector();
   void ResumeThreadForInspector();
 
+ protected:
+  void Unpark() override;
+  void RemoveCanceledTask(Task* task) override;
+  std::shared_ptr<Task> GetNextUrgentTask(DelayedTimeInMs now) override;
+  std::shared_ptr<Task> GetNextIdleTask(DelayedTimeInMs now) override;
+  DelayedTimeInMs GetNextWakeUpTime(DelayedTimeInMs now) override;
+
  private:
+  friend class JavaScriptThreadPool;
+
+  enum class TaskKind { kNormal, kAnimation, kIdle };
+
+  // kRunningNotified means new work arrived while a slice was running.
+  enum SliceState : uint32_t { kIdle, kScheduled, kRunning, kRunningNotified };
+
+  // Moves an idle pooled runner to kScheduled, true if the caller must then
+  // queue it on the pool.
+  bool RequestSlice();
+  // Runs ready tasks on the calling pool thread until there are none left or
+  // the slice is used up. Returns true to be queued again right away,
+  // otherwise `wake_up_time` tells when the pool has to schedule it again.
+  bool RunSlice(DelayedTimeInMs* wake_up_time);
+  void RunTaskWithFrameAccounting(Task* task);
+
+  void MergePendingFrameWork(DelayedTimeInMs now);
+  void BeginFrame(DelayedTimeInMs frame_time, DelayedTimeInMs frame_interval,
+                  DelayedTimeInMs now);
+  bool IsInFrameMode(DelayedTimeInMs now) const;
+  void AccountTaskTime(uint64_t time_in_us);
+
   std::atomic_bool is_inspector_call_pause_{false};
+
+  std::shared_ptr<JavaScriptThreadPool> pool_;
+  std::atomic<uint32_t> slice_state_{kIdle};
+  std::function<void()> on_slice_enter_;
+  std::function<void()> on_slice_exit_;
+  // Points into the running slice, set by the destructor.
+  bool* destroyed_flag_ = nullptr;
+
+  // Written by any thread under `frame_mutex_`, `has_pending_frame_work_`
+  // lets the runner skip the lock when there is nothing new.
+  std::mutex frame_mutex_;
+  std::atomic<bool> has_pending_frame_work_{false};
+  bool has_pending_vsync_ = false;
+  DelayedTimeInMs pending_frame_time_ = 0;
+  DelayedTimeInMs pending_frame_interval_ = 0;
+  std::vector<std::shared_ptr<Task>> pending_animation_callbacks_;
+  std::vector<std::shared_ptr<IdleTask>> pending_idle_tasks_;
+  FrameStats frame_stats_;
+
+  // Only touched on the runner thread.
+  std::deque<std::shared_ptr<Task>> animation_callbacks_;
+  std::deque<std::shared_ptr<IdleTask>> idle_tasks_;
+  bool has_frame_ = false;
+  DelayedTimeInMs frame_deadline_ = 0;
+  DelayedTimeInMs last_vsync_time_ = 0;
+  TaskKind current_task_kind_ = TaskKind::kNormal;
+  FrameStats current_frame_;
 };
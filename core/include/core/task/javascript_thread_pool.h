@@ -0,0 +1,102 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <condition_variable>  // NOLINT(build/c++11)
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>  // NOLINT(build/c++11)
+#include <unordered_map>
+#include <vector>
+
+#include "core/base/thread.h"
+
+class JavaScriptTaskRunner;
+
+// A fixed set of JS threads serving the JavaScriptTaskRunners of many engines.
+// A runner is on at most one thread at a time, so its tasks keep their FIFO
+// order, and it gives the thread back after a time slice when other runners
+// are waiting. Idle runners hold no thread at all.
+class JavaScriptThreadPool {
+ public:
+  using DelayedTimeInMs = uint64_t;
+
+  explicit JavaScriptThreadPool(uint32_t pool_size);
+  ~JavaScriptThreadPool();
+
+  JavaScriptThreadPool(const JavaScriptThreadPool&) = delete;
+  JavaScriptThreadPool& operator=(const JavaScriptThreadPool&) = delete;
+
+  // Process wide pool, never destroyed.
+  static std::shared_ptr<JavaScriptThreadPool> GetInstance();
+
+  uint32_t GetPoolSize() const { return pool_size_; }
+
+ private:
+  friend class JavaScriptTaskRunner;
+
+  using TimerMap = std::multimap<DelayedTimeInMs, JavaScriptTaskRunner*>;
+
+  struct Client {
+    // A runner that asks for a new slice right after giving up the thread can
+    // briefly be on two threads, the first one only doing bookkeeping.
+    uint32_t running_count = 0;
+    bool has_wake_up = false;
+    TimerMap::iterator wake_up;
+  };
+
+  class PoolThread : public hippy::base::Thread {
+   public:
+    explicit PoolThread(JavaScriptThreadPool* pool);
+    ~PoolThread() override;
+
+    void Run() override;
+
+   private:
+    JavaScriptThreadPool* pool_;
+  };
+
+  void Register(JavaScriptTaskRunner* runner);
+  // Waits for a terminated runner to finish its remaining tasks.
+  void WaitForTermination(JavaScriptTaskRunner* runner);
+  // Drops the runner right away, waiting only for a slice in progress.
+  void Unregister(JavaScriptTaskRunner* runner);
+  // Queues a runner for which JavaScriptTaskRunner::RequestSlice succeeded.
+  void Schedule(JavaScriptTaskRunner* runner);
+  void RunLoop();
+  void SetWakeUp(JavaScriptTaskRunner* runner, Client& client, DelayedTimeInMs time);
+  void RemoveClient(JavaScriptTaskRunner* runner);
+
+  uint32_t pool_size_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::condition_variable idle_cv_;
+  std::unordered_map<JavaScriptTaskRunner*, Client> clients_;
+  std::deque<JavaScriptTaskRunner*> ready_runners_;
+  TimerMap wake_ups_;
+  bool terminated_ = false;
+  std::vector<std::unique_ptr<PoolThread>> threads_;
+};
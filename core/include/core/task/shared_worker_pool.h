@@ -0,0 +1,86 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <condition_variable>  // NOLINT(build/c++11)
+#include <memory>
+#include <mutex>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "core/base/thread.h"
+
+class WorkerTaskRunner;
+
+// Threads shared by the WorkerTaskRunners of several engines. Every runner
+// keeps its own logical queue, pool threads take one task at a time from the
+// runners in round-robin order so a busy engine cannot starve the others.
+class SharedWorkerPool {
+ public:
+  explicit SharedWorkerPool(uint32_t pool_size);
+  ~SharedWorkerPool();
+
+  SharedWorkerPool(const SharedWorkerPool&) = delete;
+  SharedWorkerPool& operator=(const SharedWorkerPool&) = delete;
+
+  // Process wide pool sized from the number of CPU cores, never destroyed.
+  static std::shared_ptr<SharedWorkerPool> GetInstance();
+
+  uint32_t GetPoolSize() const { return pool_size_; }
+
+ private:
+  friend class WorkerTaskRunner;
+
+  struct Client {
+    WorkerTaskRunner* runner;
+    // Tasks of this runner currently running on pool threads.
+    uint32_t running_count = 0;
+  };
+
+  class PoolThread : public hippy::base::Thread {
+   public:
+    explicit PoolThread(SharedWorkerPool* pool);
+    ~PoolThread() override;
+
+    void Run() override;
+
+   private:
+    SharedWorkerPool* pool_;
+  };
+
+  void Register(WorkerTaskRunner* runner);
+  // Waits until no task of the runner is running on another pool thread.
+  void Unregister(WorkerTaskRunner* runner);
+  void Notify();
+  void RunLoop();
+
+  uint32_t pool_size_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::condition_variable idle_cv_;
+  std::vector<std::shared_ptr<Client>> clients_;
+  size_t next_client_ = 0;
+  bool terminated_ = false;
+  std::vector<std::unique_ptr<PoolThread>> threads_;
+};
@@ -24,31 +24,75 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <condition_variable>  // NOLINT(build/c++11)
+#include <deque>
 #include <map>
 #include <memory>
-#include <queue>
+#include <mutex>  // NOLINT(build/c++11)
 #include <vector>
 
+#if defined(ENABLE_COROUTINE)
+#include <coroutine>
+#endif
+
 #include "core/base/base_time.h"
 #include "core/base/macros.h"
+#include "core/base/task_telemetry.h"
 #include "core/base/thread.h"
 #include "core/task/common_task.h"
 
+class SharedWorkerPool;
+
 class WorkerTaskRunner {
  public:
-  explicit WorkerTaskRunner(uint32_t pool_size);
-  ~WorkerTaskRunner() = default;
+  using SchedulingParams = hippy::base::Thread::SchedulingParams;
 
+  explicit WorkerTaskRunner(uint32_t pool_size, const SchedulingParams& params = {});
+  // Logical runner without threads of its own, its tasks run on `shared_pool`.
+  explicit WorkerTaskRunner(std::shared_ptr<SharedWorkerPool> shared_pool);
+  ~WorkerTaskRunner();
+
+  // Tasks posted from one of this runner's worker threads go to that worker's
+  // own queue, other tasks are spread across the workers round-robin. Idle
+  // workers steal from their siblings.
   void PostTask(std::unique_ptr<CommonTask> task,
                 uint32_t priority = WorkerTaskRunner::kDefaultTaskPriority);
-  std::unique_ptr<CommonTask> GetNext();
+  // Drops queued tasks and waits for the running ones, whether the runner has
+  // threads of its own or not. A runner on a shared pool leaves the pool
+  // threads alive for the other runners.
   void Terminate();
 
+  // Same contract as TaskRunner::EnableTelemetry.
+  hippy::base::TaskTelemetry* EnableTelemetry();
+  hippy::base::TaskTelemetry* GetTelemetry() const;
+
+#if defined(ENABLE_COROUTINE)
+  // `co_await runner->Schedule()` continues the coroutine on a worker thread.
+  class ScheduleAwaiter {
+   public:
+    ScheduleAwaiter(WorkerTaskRunner* runner, uint32_t priority)
+        : runner_(runner), priority_(priority) {}
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle);
+    void await_resume() const noexcept {}
+
+   private:
+    WorkerTaskRunner* runner_;
+    uint32_t priority_;
+  };
+
+  ScheduleAwaiter Schedule(uint32_t priority = WorkerTaskRunner::kDefaultTaskPriority) {
+    return ScheduleAwaiter(this, priority);
+  }
+#endif
+
  private:
+  friend class SharedWorkerPool;
+
   class WorkerThread : public hippy::base::Thread {
    public:
-    explicit WorkerThread(WorkerTaskRunner*);
+    WorkerThread(WorkerTaskRunner*, uint32_t index);
     ~WorkerThread();
     WorkerThread(const WorkerThread &) = delete;
     WorkerThread &operator=(const WorkerThread &) = delete;
@@ -57,21 +101,41 @@ class WorkerTaskRunner {
 
    private:
     WorkerTaskRunner* runner_;
+    uint32_t index_;
   };
 
   static const uint32_t kDefaultTaskPriority;
   static const uint32_t kHighPriorityTaskPriority;
   static const uint32_t kLowPriorityTaskPriority;
-  using Entry = std::pair<uint32_t, std::unique_ptr<CommonTask>>;
-  struct EntryCompare {
-    bool operator()(const Entry& left, const Entry& right) const {
-      return left.first > right.first;
-    }
+
+  // Priorities are bucketed into lanes, lower lanes always run first.
+  enum Lane : uint32_t { kHighLane = 0, kDefaultLane, kLowLane, kLaneCount };
+  static Lane GetLane(uint32_t priority);
+
+  struct WorkQueue {
+    std::mutex mutex;
+    std::deque<std::unique_ptr<CommonTask>> lanes[kLaneCount];
   };
-  std::priority_queue<Entry, std::vector<Entry>, EntryCompare> task_queue_;
+
+  std::unique_ptr<CommonTask> GetNext(uint32_t worker_index);
+  std::unique_ptr<CommonTask> PopLocal(uint32_t worker_index, Lane lane);
+  std::unique_ptr<CommonTask> Steal(uint32_t thief_index, Lane lane);
+  int32_t GetCurrentWorkerIndex() const;
+  // Called by SharedWorkerPool threads.
+  std::unique_ptr<CommonTask> PopForPool();
+  void RunTask(CommonTask* task);
+
+  std::vector<std::unique_ptr<WorkQueue>> queues_;
+  // Number of queued tasks over all queues, used to decide when to sleep.
+  std::atomic<uint32_t> pending_count_{0};
+  std::atomic<uint32_t> sleeping_count_{0};
+  std::atomic<uint32_t> next_queue_{0};
+  std::atomic<bool> terminated_{false};
+  std::atomic<hippy::base::TaskTelemetry*> telemetry_{nullptr};
   std::condition_variable cv_;
   std::mutex mutex_;
   uint32_t pool_size_;
-  bool terminated_ = false;
+  SchedulingParams scheduling_params_;
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
+  std::shared_ptr<SharedWorkerPool> shared_pool_;
 };
@@ -46,3 +46,20 @@ global.clearInterval = (timerId) => {
     timer.ClearInterval(timerId);
   }
 };
+
+global.requestIdleCallback = (cb, options) => {
+  const timeout = (options && options.timeout) || 0;
+  return timer.RequestIdleCallback((remaining, didTimeout) => {
+    const start = Date.now();
+    cb({
+      didTimeout,
+      timeRemaining: () => Math.max(0, remaining - (Date.now() - start)),
+    });
+  }, timeout);
+};
+
+global.cancelIdleCallback = (id) => {
+  if (Number.isInteger(id) && id > 0) {
+    timer.CancelIdleCallback(id);
+  }
+};
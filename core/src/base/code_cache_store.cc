@@ -0,0 +1,414 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "core/base/code_cache_store.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "base/logging.h"
+
+namespace hippy {
+namespace base {
+
+namespace {
+
+constexpr char kIndexFileName[] = "index";
+constexpr char kIndexHeader[] = "hippy-code-cache-1";
+constexpr char kTempFileSuffix[] = ".tmp";
+constexpr uint64_t kHashPrime = 0x100000001b3ULL;
+
+std::mutex instances_mutex;
+std::unordered_map<std::string, std::weak_ptr<CodeCacheStore>> instances;
+
+std::string ToHex(uint64_t value) {
+  static const char kDigits[] = "0123456789abcdef";
+  std::string hex(16, '0');
+  for (int i = 15; i >= 0; --i) {
+    hex[static_cast<size_t>(i)] = kDigits[value & 0xf];
+    value >>= 4;
+  }
+  return hex;
+}
+
+bool WriteAll(int fd, const uint8_t* data, size_t size) {
+  while (size) {
+    ssize_t written = write(fd, data, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data += written;
+    size -= static_cast<size_t>(written);
+  }
+  return true;
+}
+
+// Readers see either the old file or the complete new one.
+bool WriteFileAtomically(const std::string& path, const std::string& temp_path,
+                         const uint8_t* data, size_t size) {
+  int fd = open(temp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+  if (fd < 0) {
+    TDF_BASE_DLOG(WARNING) << "CodeCacheStore open failed, path = " << temp_path
+                           << ", errno = " << errno;
+    return false;
+  }
+  bool is_success = WriteAll(fd, data, size) && fsync(fd) == 0;
+  close(fd);
+  if (!is_success || rename(temp_path.c_str(), path.c_str()) != 0) {
+    TDF_BASE_DLOG(WARNING) << "CodeCacheStore write failed, path = " << path
+                           << ", errno = " << errno;
+    unlink(temp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+void CodeCacheStore::Hasher::Update(const void* data, size_t length) {
+  auto bytes = static_cast<const uint8_t*>(data);
+  length_ += length;
+  while (pending_size_ && length) {
+    pending_[pending_size_++] = *bytes++;
+    --length;
+    if (pending_size_ == sizeof(pending_)) {
+      uint64_t word;
+      memcpy(&word, pending_, sizeof(word));
+      Mix(word);
+      pending_size_ = 0;
+    }
+  }
+  for (; length >= sizeof(uint64_t); length -= sizeof(uint64_t), bytes += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, bytes, sizeof(word));
+    Mix(word);
+  }
+  memcpy(pending_ + pending_size_, bytes, length);
+  pending_size_ += length;
+}
+
+uint64_t CodeCacheStore::Hasher::Finish() const {
+  Hasher hasher = *this;
+  uint64_t word = 0;
+  memcpy(&word, hasher.pending_, hasher.pending_size_);
+  hasher.Mix(word);
+  hasher.Mix(hasher.length_);
+  uint64_t hash = hasher.hash_;
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+// FNV-1a over words instead of bytes. Collisions only cost a miss, the
+// engine rejects a cache that does not match the source.
+void CodeCacheStore::Hasher::Mix(uint64_t word) {
+  hash_ = (hash_ ^ word) * kHashPrime;
+  hash_ ^= hash_ >> 32;
+}
+
+CodeCacheStore::Data::~Data() {
+  munmap(address_, size_);
+}
+
+CodeCacheStore::CodeCacheStore(const std::string& dir,
+                               const std::string& tag,
+                               size_t max_size_in_bytes)
+    : dir_(dir), tag_(tag), max_size_in_bytes_(max_size_in_bytes) {
+  while (dir_.length() > 1 && dir_.back() == '/') {
+    dir_.pop_back();
+  }
+  Hasher hasher;
+  hasher.Update(tag_.c_str(), tag_.length());
+  tag_hash_ = hasher.Finish();
+}
+
+std::shared_ptr<CodeCacheStore> CodeCacheStore::GetInstance(const std::string& dir,
+                                                            const std::string& tag,
+                                                            size_t max_size_in_bytes) {
+  std::lock_guard<std::mutex> lock(instances_mutex);
+  std::shared_ptr<CodeCacheStore> store = instances[dir].lock();
+  if (!store) {
+    store = std::make_shared<CodeCacheStore>(dir, tag, max_size_in_bytes);
+    instances[dir] = store;
+  } else if (store->tag_ != tag || store->max_size_in_bytes_ != max_size_in_bytes) {
+    // Two stores on one directory would delete each other's files.
+    TDF_BASE_LOG(ERROR) << "CodeCacheStore already open, dir = " << dir
+                        << ", tag = " << store->tag_ << ", max_size = "
+                        << store->max_size_in_bytes_ << ", requested tag = " << tag
+                        << ", requested max_size = " << max_size_in_bytes;
+  }
+  return store;
+}
+
+std::string CodeCacheStore::MakeKey(uint64_t content_hash) const {
+  return ToHex(content_hash) + ToHex(tag_hash_);
+}
+
+std::string CodeCacheStore::FindKey(const std::string& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  LoadIndexIfNeeded();
+  auto it = name_to_key_.find(name);
+  return it != name_to_key_.end() ? it->second : std::string();
+}
+
+std::shared_ptr<CodeCacheStore::Data> CodeCacheStore::Get(const std::string& key) {
+  size_t size;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    LoadIndexIfNeeded();
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      return nullptr;
+    }
+    it->second.last_used = ++use_clock_;
+    size = it->second.size;
+    if (++unsaved_use_count_ >= kMaxUnsavedUseCount) {
+      SaveIndex();
+    }
+  }
+
+  std::string path = GetPath(key);
+  int fd = open(path.c_str(), O_RDONLY);
+  struct stat st{};
+  void* address = MAP_FAILED;
+  if (fd >= 0) {
+    if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) == size) {
+      address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+  }
+  if (address == MAP_FAILED) {
+    TDF_BASE_DLOG(WARNING) << "CodeCacheStore entry unreadable, path = " << path;
+    Remove(key);
+    return nullptr;
+  }
+  return std::make_shared<Data>(address, size);
+}
+
+bool CodeCacheStore::Put(const std::string& key,
+                         const std::string& name,
+                         const uint8_t* data,
+                         size_t size) {
+  if (!size || size > max_size_in_bytes_) {
+    return false;
+  }
+  uint64_t temp_file_id;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    LoadIndexIfNeeded();
+    temp_file_id = ++temp_file_id_;
+  }
+  std::string temp_path = GetPath(key) + kTempFileSuffix + std::to_string(temp_file_id);
+  if (!WriteFileAtomically(GetPath(key), temp_path, data, size)) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  // Tabs and line breaks would break the index, such names are not kept.
+  bool is_name_valid = !name.empty() && name.find_first_of("\t\r\n") == std::string::npos;
+  auto name_it = name_to_key_.find(name);
+  if (is_name_valid && name_it != name_to_key_.end() && name_it->second != key) {
+    // The content the name pointed to is out of date for this name.
+    RemoveName(name);
+  }
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    it = entries_.emplace(key, Entry{0, 0, {}}).first;
+  }
+  Entry& entry = it->second;
+  total_size_ = total_size_ - entry.size + size;
+  entry.size = size;
+  entry.last_used = ++use_clock_;
+  if (is_name_valid && name_to_key_.emplace(name, key).second) {
+    entry.names.push_back(name);
+  }
+  Evict(key);
+  SaveIndex();
+  TDF_BASE_DLOG(INFO) << "CodeCacheStore Put, key = " << key << ", size = " << size
+                      << ", total_size = " << total_size_;
+  return true;
+}
+
+void CodeCacheStore::Remove(const std::string& key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  LoadIndexIfNeeded();
+  if (entries_.find(key) == entries_.end()) {
+    return;
+  }
+  RemoveEntry(key);
+  SaveIndex();
+}
+
+size_t CodeCacheStore::GetTotalSize() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  LoadIndexIfNeeded();
+  return total_size_;
+}
+
+void CodeCacheStore::LoadIndexIfNeeded() {
+  if (is_index_loaded_) {
+    return;
+  }
+  is_index_loaded_ = true;
+  mkdir(dir_.c_str(), S_IRWXU);
+
+  std::ifstream index(GetPath(kIndexFileName));
+  std::string line;
+  bool is_tag_valid = std::getline(index, line) &&
+      line == std::string(kIndexHeader) + '\t' + tag_;
+  while (is_tag_valid && std::getline(index, line)) {
+    std::istringstream fields(line);
+    std::string key;
+    Entry entry{};
+    if (!std::getline(fields, key, '\t') || !(fields >> entry.size >> entry.last_used)) {
+      continue;
+    }
+    fields.get();
+    struct stat st{};
+    if (stat(GetPath(key).c_str(), &st) != 0 || static_cast<size_t>(st.st_size) != entry.size) {
+      continue;
+    }
+    if (use_clock_ < entry.last_used) {
+      use_clock_ = entry.last_used;
+    }
+    std::string name;
+    while (std::getline(fields, name, '\t')) {
+      if (!name.empty() && name_to_key_.emplace(name, key).second) {
+        entry.names.push_back(name);
+      }
+    }
+    total_size_ += entry.size;
+    entries_[key] = std::move(entry);
+  }
+  index.close();
+
+  // Everything else, e.g. caches of another engine version, files of older
+  // releases or interrupted writes, only takes space.
+  DIR* dir = opendir(dir_.c_str());
+  if (dir) {
+    struct dirent* dirent;
+    while ((dirent = readdir(dir)) != nullptr) {
+      std::string file_name = dirent->d_name;
+      if (file_name == "." || file_name == ".." || file_name == kIndexFileName ||
+          entries_.find(file_name) != entries_.end()) {
+        continue;
+      }
+      std::string path = GetPath(file_name);
+      struct stat st{};
+      if (lstat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode)) {
+        TDF_BASE_DLOG(INFO) << "CodeCacheStore remove stale file, path = " << path;
+        unlink(path.c_str());
+      }
+    }
+    closedir(dir);
+  }
+  Evict(std::string());
+  SaveIndex();
+  TDF_BASE_DLOG(INFO) << "CodeCacheStore loaded, dir = " << dir_
+                      << ", entries = " << entries_.size() << ", total_size = " << total_size_;
+}
+
+void CodeCacheStore::SaveIndex() {
+  std::ostringstream index;
+  index << kIndexHeader << '\t' << tag_ << '\n';
+  for (const auto& it : entries_) {
+    index << it.first << '\t' << it.second.size << '\t' << it.second.last_used;
+    for (const auto& name : it.second.names) {
+      index << '\t' << name;
+    }
+    index << '\n';
+  }
+  std::string content = index.str();
+  std::string temp_path = GetPath(kIndexFileName) + kTempFileSuffix;
+  WriteFileAtomically(GetPath(kIndexFileName), temp_path,
+                      reinterpret_cast<const uint8_t*>(content.c_str()), content.length());
+  unsaved_use_count_ = 0;
+}
+
+void CodeCacheStore::RemoveEntry(const std::string& key) {
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    return;
+  }
+  unlink(GetPath(key).c_str());
+  total_size_ -= it->second.size;
+  for (const auto& name : it->second.names) {
+    name_to_key_.erase(name);
+  }
+  entries_.erase(it);
+}
+
+void CodeCacheStore::RemoveName(const std::string& name) {
+  auto name_it = name_to_key_.find(name);
+  if (name_it == name_to_key_.end()) {
+    return;
+  }
+  std::string key = name_it->second;
+  name_to_key_.erase(name_it);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    return;
+  }
+  std::vector<std::string>& names = it->second.names;
+  names.erase(std::remove(names.begin(), names.end(), name), names.end());
+  // Kept while other names still point to the same content.
+  if (names.empty()) {
+    RemoveEntry(key);
+  }
+}
+
+void CodeCacheStore::Evict(const std::string& keep_key) {
+  while (total_size_ > max_size_in_bytes_) {
+    auto victim = entries_.end();
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->first != keep_key &&
+          (victim == entries_.end() || it->second.last_used < victim->second.last_used)) {
+        victim = it;
+      }
+    }
+    if (victim == entries_.end()) {
+      return;
+    }
+    TDF_BASE_DLOG(INFO) << "CodeCacheStore evict, key = " << victim->first;
+    RemoveEntry(victim->first);
+  }
+}
+
+std::string CodeCacheStore::GetPath(const std::string& file_name) const {
+  return dir_ + '/' + file_name;
+}
+
+}  // namespace base
+}  // namespace hippy
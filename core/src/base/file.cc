@@ -127,5 +127,34 @@ uint64_t HippyFile::GetFileModifytime(const unicode_string_view& file_path) {
   fclose(fp);
   return modify_time;
 }
+
+bool HippyFile::ReadFileInChunks(const unicode_string_view& file_path,
+                                 size_t chunk_size,
+                                 const std::function<void(const char* data, size_t length)>& on_chunk) {
+  unicode_string_view owner(u8""_u8s);
+  const char* path = StringViewUtils::ToConstCharPointer(file_path, owner);
+  std::ifstream file(path, std::ios::in | std::ios::binary);
+  if (file.fail()) {
+    TDF_BASE_DLOG(INFO) << "ReadFileInChunks fail, file_path = " << file_path;
+    return false;
+  }
+  std::unique_ptr<char[]> buffer(new char[chunk_size]);
+  std::streamsize size;
+  if (!numeric_cast<size_t, std::streamsize>(chunk_size, size)) {
+    return false;
+  }
+  while (file) {
+    file.read(buffer.get(), size);
+    std::streamsize read_size = file.gcount();
+    if (read_size > 0) {
+      on_chunk(buffer.get(), static_cast<size_t>(read_size));
+    }
+  }
+  bool is_eof = file.eof();
+  file.close();
+  TDF_BASE_DLOG(INFO) << "ReadFileInChunks end, file_path = " << file_path
+                      << ", is_eof = " << is_eof;
+  return is_eof;
+}
 }  // namespace base
 }  // namespace hippy
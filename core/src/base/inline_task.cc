@@ -0,0 +1,130 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "core/base/inline_task.h"
+
+#include <stddef.h>
+
+#include <cstddef>
+#include <mutex>  // NOLINT(build/c++11)
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Room for the task and the control block std::allocate_shared puts in front.
+constexpr size_t kBlockSize = sizeof(hippy::base::InlineTask) + 64;
+constexpr size_t kMaxPooledBlockCount = 256;
+
+class BlockPool {
+ public:
+  void* Allocate() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!blocks_.empty()) {
+        void* block = blocks_.back();
+        blocks_.pop_back();
+        return block;
+      }
+    }
+    return ::operator new(kBlockSize);
+  }
+
+  void Free(void* block) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (blocks_.size() < kMaxPooledBlockCount) {
+        blocks_.push_back(block);
+        return;
+      }
+    }
+    ::operator delete(block);
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<void*> blocks_;
+};
+
+BlockPool& GetBlockPool() {
+  // Never destroyed, tasks may still be released during static destruction.
+  static BlockPool* pool = new BlockPool();
+  return *pool;
+}
+
+template <typename T>
+struct PoolAllocator {
+  using value_type = T;
+
+  PoolAllocator() = default;
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U>&) {}  // NOLINT(runtime/explicit)
+
+  T* allocate(size_t n) {
+    if (n == 1 && sizeof(T) <= kBlockSize && alignof(T) <= alignof(std::max_align_t)) {
+      return static_cast<T*>(GetBlockPool().Allocate());
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T* p, size_t n) {
+    if (n == 1 && sizeof(T) <= kBlockSize && alignof(T) <= alignof(std::max_align_t)) {
+      GetBlockPool().Free(p);
+      return;
+    }
+    ::operator delete(p);
+  }
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U>&) const { return true; }
+  template <typename U>
+  bool operator!=(const PoolAllocator<U>&) const { return false; }
+};
+
+}  // namespace
+
+namespace hippy {
+namespace base {
+
+std::shared_ptr<InlineTask> InlineTask::Create(InlineClosure closure) {
+  return std::allocate_shared<InlineTask>(PoolAllocator<InlineTask>(), std::move(closure));
+}
+
+InlineTask::InlineTask(InlineClosure closure) : closure_(std::move(closure)) {}
+
+bool InlineTask::isPriorityTask() {
+  return false;
+}
+
+void InlineTask::Run() {
+  if (closure_) {
+    closure_();
+  }
+}
+
+void InlineTask::OnCanceled() {
+  closure_.Reset();
+}
+
+}  // namespace base
+}  // namespace hippy
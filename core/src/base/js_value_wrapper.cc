@@ -22,6 +22,10 @@
 
 #include "core/base/js_value_wrapper.h"
 
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
 #include "core/base/hash.h"
 
 using JSValueWrapper = hippy::base::JSValueWrapper;
@@ -45,8 +49,16 @@ std::size_t std::hash<JSValueWrapper>::operator()(
       return std::hash<std::string>{}(value.string_value_);
     case JSValueWrapper::Type::Array:
       return std::hash<JSValueWrapper::JSArrayType>{}(value.array_value_);
-    case JSValueWrapper::Type::Object:
-      return std::hash<JSValueWrapper::JSObjectType>{}(value.object_value_);
+    case JSValueWrapper::Type::Object: {
+      // Sums the entries, their order does not matter.
+      size_t seed = 0;
+      for (const auto& entry : value.object_value_) {
+        size_t entry_seed = std::hash<hippy::base::JSValueKey>{}(entry.first);
+        std::hash_combine(entry_seed, entry.second);
+        seed += entry_seed;
+      }
+      return seed;
+    }
     default:
       break;
   }
@@ -57,6 +69,335 @@ std::size_t std::hash<JSValueWrapper>::operator()(
 namespace hippy {
 namespace base {
 
+namespace {
+
+// Returns nullptr once kMaxInternedCount keys are interned.
+const std::string* InternKey(std::string_view key) {
+  static std::mutex mutex;
+  // Leaked on purpose, keys may be used while static objects are destroyed.
+  static auto* keys =
+      new std::unordered_map<std::string_view, std::unique_ptr<std::string>>();
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = keys->find(key);
+  if (it != keys->end()) {
+    return it->second.get();
+  }
+  if (keys->size() >= JSValueKey::kMaxInternedCount) {
+    return nullptr;
+  }
+  auto interned = std::make_unique<std::string>(key);
+  const std::string* ret = interned.get();
+  keys->emplace(std::string_view(*ret), std::move(interned));
+  return ret;
+}
+
+}  // namespace
+
+JSValueArena::JSValueArena(size_t block_size) : block_size_(block_size) {}
+
+void* JSValueArena::Allocate(size_t size, size_t alignment) {
+  auto aligned = [alignment](char* p) {
+    auto address = reinterpret_cast<uintptr_t>(p);
+    return reinterpret_cast<char*>((address + alignment - 1) & ~(alignment - 1));
+  };
+  if (cursor_ && aligned(cursor_) + size <= end_) {
+    char* ret = aligned(cursor_);
+    cursor_ = ret + size;
+    return ret;
+  }
+  size_t block_size = std::max(block_size_, size + alignment);
+  blocks_.push_back(std::make_unique<char[]>(block_size));
+  allocated_size_ += block_size;
+  char* block = blocks_.back().get();
+  char* ret = aligned(block);
+  // Large allocations take a block of their own, the current one still has
+  // room for small ones.
+  if (size <= block_size_ / 4) {
+    cursor_ = ret + size;
+    end_ = block + block_size;
+  }
+  return ret;
+}
+
+JSValueKey::JSValueKey(std::string_view key)
+    : size_(static_cast<uint32_t>(key.size())) {
+  if (key.size() <= kInlineCapacity) {
+    memcpy(inline_, key.data(), key.size());
+    inline_[key.size()] = '\0';
+    storage_ = Storage::Inline;
+    return;
+  }
+  const std::string* interned = key.size() <= kMaxInternedSize ? InternKey(key) : nullptr;
+  if (interned) {
+    interned_ = interned;
+    storage_ = Storage::Interned;
+  } else {
+    owned_ = new std::string(key);
+    storage_ = Storage::Owned;
+  }
+}
+
+JSValueKey::JSValueKey(const JSValueKey& source)
+    : size_(source.size_), storage_(source.storage_) {
+  switch (storage_) {
+    case Storage::Inline:
+      memcpy(inline_, source.inline_, sizeof(inline_));
+      break;
+    case Storage::Interned:
+      interned_ = source.interned_;
+      break;
+    case Storage::Owned:
+      owned_ = new std::string(*source.owned_);
+      break;
+  }
+}
+
+// Leaves the source empty.
+JSValueKey::JSValueKey(JSValueKey&& source) noexcept
+    : size_(source.size_), storage_(source.storage_) {
+  switch (storage_) {
+    case Storage::Inline:
+      memcpy(inline_, source.inline_, sizeof(inline_));
+      break;
+    case Storage::Interned:
+      interned_ = source.interned_;
+      break;
+    case Storage::Owned:
+      owned_ = source.owned_;
+      break;
+  }
+  source.inline_[0] = '\0';
+  source.size_ = 0;
+  source.storage_ = Storage::Inline;
+}
+
+JSValueKey::~JSValueKey() {
+  deallocate();
+}
+
+JSValueKey& JSValueKey::operator=(const JSValueKey& rhs) {
+  if (this != &rhs) {
+    JSValueKey copy(rhs);
+    *this = std::move(copy);
+  }
+  return *this;
+}
+
+JSValueKey& JSValueKey::operator=(JSValueKey&& rhs) noexcept {
+  if (this != &rhs) {
+    deallocate();
+    new (this) JSValueKey(std::move(rhs));
+  }
+  return *this;
+}
+
+const char* JSValueKey::data() const noexcept {
+  switch (storage_) {
+    case Storage::Interned:
+      return interned_->c_str();
+    case Storage::Owned:
+      return owned_->c_str();
+    default:
+      return inline_;
+  }
+}
+
+inline void JSValueKey::deallocate() {
+  if (storage_ == Storage::Owned) {
+    delete owned_;
+  }
+}
+
+JSValueObject::JSValueObject() = default;
+
+JSValueObject::JSValueObject(const allocator_type& allocator)
+    : entries_(allocator) {}
+
+JSValueObject::JSValueObject(const JSValueObject& source)
+    : entries_(source.entries_) {}
+
+JSValueObject::JSValueObject(JSValueObject&& source) noexcept
+    : entries_(std::move(source.entries_)), index_(std::move(source.index_)) {}
+
+JSValueObject::~JSValueObject() = default;
+
+JSValueObject& JSValueObject::operator=(const JSValueObject& rhs) {
+  if (this != &rhs) {
+    entries_ = rhs.entries_;
+    index_ = nullptr;
+  }
+  return *this;
+}
+
+// Positions stay the same, whether the entries are moved or their
+// allocators differ and each entry is.
+JSValueObject& JSValueObject::operator=(JSValueObject&& rhs) noexcept {
+  if (this != &rhs) {
+    entries_ = std::move(rhs.entries_);
+    index_ = std::move(rhs.index_);
+  }
+  return *this;
+}
+
+JSValueObject::iterator JSValueObject::begin() noexcept {
+  return entries_.begin();
+}
+
+JSValueObject::iterator JSValueObject::end() noexcept {
+  return entries_.end();
+}
+
+JSValueObject::const_iterator JSValueObject::begin() const noexcept {
+  return entries_.begin();
+}
+
+JSValueObject::const_iterator JSValueObject::end() const noexcept {
+  return entries_.end();
+}
+
+JSValueObject::size_type JSValueObject::size() const noexcept {
+  return entries_.size();
+}
+
+void JSValueObject::reserve(size_type count) {
+  entries_.reserve(count);
+}
+
+void JSValueObject::clear() noexcept {
+  entries_.clear();
+  index_ = nullptr;
+}
+
+JSValueWrapper& JSValueObject::operator[](const JSValueKey& key) {
+  size_type pos = FindIndex(key);
+  if (pos != entries_.size()) {
+    return entries_[pos].second;
+  }
+  return emplace_back(key, JSValueWrapper()).second;
+}
+
+JSValueWrapper& JSValueObject::operator[](JSValueKey&& key) {
+  size_type pos = FindIndex(key);
+  if (pos != entries_.size()) {
+    return entries_[pos].second;
+  }
+  return emplace_back(std::move(key), JSValueWrapper()).second;
+}
+
+JSValueObject::iterator JSValueObject::find(const JSValueKey& key) {
+  return entries_.begin() + static_cast<std::ptrdiff_t>(FindIndex(key));
+}
+
+JSValueObject::const_iterator JSValueObject::find(const JSValueKey& key) const {
+  return entries_.begin() + static_cast<std::ptrdiff_t>(FindIndex(key));
+}
+
+JSValueObject::size_type JSValueObject::count(const JSValueKey& key) const {
+  return FindIndex(key) != entries_.size() ? 1 : 0;
+}
+
+std::pair<JSValueObject::iterator, bool> JSValueObject::emplace(JSValueKey key,
+                                                                JSValueWrapper value) {
+  size_type pos = FindIndex(key);
+  if (pos != entries_.size()) {
+    return {entries_.begin() + static_cast<std::ptrdiff_t>(pos), false};
+  }
+  emplace_back(std::move(key), std::move(value));
+  return {entries_.end() - 1, true};
+}
+
+std::pair<JSValueObject::iterator, bool> JSValueObject::insert(const value_type& value) {
+  return emplace(value.first, value.second);
+}
+
+JSValueObject::size_type JSValueObject::erase(const JSValueKey& key) {
+  size_type pos = FindIndex(key);
+  if (pos == entries_.size()) {
+    return 0;
+  }
+  entries_.erase(entries_.begin() + static_cast<std::ptrdiff_t>(pos));
+  index_ = nullptr;
+  return 1;
+}
+
+JSValueObject::value_type& JSValueObject::emplace_back(JSValueKey key,
+                                                       JSValueWrapper value) {
+  entries_.emplace_back(std::move(key), std::move(value));
+  if (index_) {
+    AddToIndex(entries_.size() - 1);
+  }
+  return entries_.back();
+}
+
+JSValueObject::allocator_type JSValueObject::get_allocator() const noexcept {
+  return entries_.get_allocator();
+}
+
+// Does not build an index, copies compare entry by entry in the same order
+// and only entries out of place are searched for.
+bool JSValueObject::operator==(const JSValueObject& rhs) const noexcept {
+  size_type size = entries_.size();
+  if (size != rhs.entries_.size()) {
+    return false;
+  }
+  for (size_type i = 0; i < size; ++i) {
+    const value_type& entry = entries_[i];
+    size_type pos = rhs.entries_[i].first == entry.first ? i : rhs.FindIndexIfIndexed(entry.first);
+    if (pos == size || rhs.entries_[pos].second != entry.second) {
+      return false;
+    }
+  }
+  return true;
+}
+
+JSValueObject::size_type JSValueObject::FindIndexIfIndexed(const JSValueKey& key) const noexcept {
+  size_type size = entries_.size();
+  if (index_) {
+    auto range = index_->equal_range(std::hash<JSValueKey>{}(key));
+    for (auto it = range.first; it != range.second; ++it) {
+      if (entries_[it->second].first == key) {
+        return it->second;
+      }
+    }
+    return size;
+  }
+  for (size_type i = 0; i < size; ++i) {
+    if (entries_[i].first == key) {
+      return i;
+    }
+  }
+  return size;
+}
+
+JSValueObject::size_type JSValueObject::FindIndex(const JSValueKey& key) const {
+  size_type size = entries_.size();
+  if (size < kIndexThreshold) {
+    for (size_type i = 0; i < size; ++i) {
+      if (entries_[i].first == key) {
+        return i;
+      }
+    }
+    return size;
+  }
+  if (!index_) {
+    index_ = std::make_unique<Index>(size);
+    for (size_type i = 0; i < size; ++i) {
+      AddToIndex(i);
+    }
+  }
+  auto range = index_->equal_range(std::hash<JSValueKey>{}(key));
+  for (auto it = range.first; it != range.second; ++it) {
+    if (entries_[it->second].first == key) {
+      return it->second;
+    }
+  }
+  return size;
+}
+
+void JSValueObject::AddToIndex(size_type pos) const {
+  index_->emplace(std::hash<JSValueKey>{}(entries_[pos].first), pos);
+}
+
 JSValueWrapper JSValueWrapper::Undefined() {
   JSValueWrapper Undefined;
   Undefined.type_ = Type::Undefined;
@@ -124,6 +465,42 @@ JSValueWrapper& JSValueWrapper::operator=(const JSValueWrapper& rhs) noexcept {
   type_ = rhs.type_;
   return *this;
 }
+JSValueWrapper& JSValueWrapper::operator=(JSValueWrapper&& rhs) noexcept {
+  if (this == &rhs) {
+    return *this;
+  }
+
+  switch (rhs.type_) {
+    case Type::Object:
+      if (type_ != Type::Object) {
+        deallocate();
+        new (&object_value_) JSObjectType(std::move(rhs.object_value_));
+      } else {
+        object_value_ = std::move(rhs.object_value_);
+      }
+      break;
+    case Type::Array:
+      if (type_ != Type::Array) {
+        deallocate();
+        new (&array_value_) JSArrayType(std::move(rhs.array_value_));
+      } else {
+        array_value_ = std::move(rhs.array_value_);
+      }
+      break;
+    case Type::String:
+      if (type_ != Type::String) {
+        deallocate();
+        new (&string_value_) std::string(std::move(rhs.string_value_));
+      } else {
+        string_value_ = std::move(rhs.string_value_);
+      }
+      break;
+    default:
+      return *this = static_cast<const JSValueWrapper&>(rhs);
+  }
+  type_ = rhs.type_;
+  return *this;
+}
 JSValueWrapper& JSValueWrapper::operator=(const int32_t rhs) noexcept {
   deallocate();
   type_ = Type::Int32;
@@ -264,6 +641,36 @@ JSValueWrapper::JSValueWrapper(const JSValueWrapper& source)
   }
 }
 
+// Leaves the source with an empty string, object or array.
+JSValueWrapper::JSValueWrapper(JSValueWrapper&& source) noexcept
+    : type_(source.type_) {
+  switch (type_) {
+    case Type::String:
+      new (&string_value_) std::string(std::move(source.string_value_));
+      break;
+    case Type::Object:
+      new (&object_value_) JSObjectType(std::move(source.object_value_));
+      break;
+    case Type::Array:
+      new (&array_value_) JSArrayType(std::move(source.array_value_));
+      break;
+    case Type::Int32:
+      int32_value_ = source.int32_value_;
+      break;
+    case Type::UInt32:
+      uint32_value_ = source.uint32_value_;
+      break;
+    case Type::Double:
+      double_value_ = source.double_value_;
+      break;
+    case Type::Boolean:
+      bool_value_ = source.bool_value_;
+      break;
+    default:
+      break;
+  }
+}
+
 inline void JSValueWrapper::deallocate() {
   switch (type_) {
     case Type::String:
@@ -273,7 +680,7 @@ inline void JSValueWrapper::deallocate() {
       array_value_.~vector();
       break;
     case Type::Object:
-      object_value_.clear();
+      object_value_.~JSObjectType();
       break;
     default:
       break;
@@ -0,0 +1,147 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "core/base/startup_timeline.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "core/base/base_time.h"
+
+namespace hippy {
+namespace base {
+
+namespace {
+
+uint32_t GetPhaseBit(StartupTimeline::Phase phase) {
+  return uint32_t{1} << static_cast<uint32_t>(phase);
+}
+
+}  // namespace
+
+StartupTimeline::ScopedPhase::ScopedPhase(StartupTimeline* timeline, Phase phase)
+    : timeline_(timeline), phase_(phase), begin_in_us_(MonotonicallyIncreasingTimeInUs()) {}
+
+StartupTimeline::ScopedPhase::~ScopedPhase() {
+  if (timeline_) {
+    timeline_->Record(phase_, begin_in_us_, MonotonicallyIncreasingTimeInUs());
+  }
+}
+
+StartupTimeline* StartupTimeline::GetProcessTimeline() {
+  static StartupTimeline* timeline = new StartupTimeline();
+  return timeline;
+}
+
+const char* StartupTimeline::GetPhaseName(Phase phase) {
+  switch (phase) {
+    case Phase::kPlatformInit:
+      return "platformInit";
+    case Phase::kIsolateCreation:
+      return "isolateCreation";
+    case Phase::kContextCreation:
+      return "contextCreation";
+    case Phase::kBootstrap:
+      return "bootstrap";
+    case Phase::kGlobalModuleRegistration:
+      return "globalModuleRegistration";
+    case Phase::kBundleRead:
+      return "bundleRead";
+    case Phase::kCodeCacheRead:
+      return "codeCacheRead";
+    case Phase::kCompile:
+      return "compile";
+    case Phase::kFirstScriptRun:
+      return "firstScriptRun";
+    case Phase::kFirstCallNatives:
+      return "firstCallNatives";
+    default:
+      return "unknown";
+  }
+}
+
+void StartupTimeline::Record(Phase phase, uint64_t begin_in_us, uint64_t end_in_us) {
+  if (HasRecorded(phase)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  uint32_t mask = recorded_mask_.load(std::memory_order_relaxed);
+  if (mask & GetPhaseBit(phase)) {
+    return;
+  }
+  events_.push_back({phase, begin_in_us, end_in_us});
+  recorded_mask_.store(mask | GetPhaseBit(phase), std::memory_order_release);
+}
+
+void StartupTimeline::Mark(Phase phase) {
+  if (HasRecorded(phase)) {
+    return;
+  }
+  uint64_t now = MonotonicallyIncreasingTimeInUs();
+  Record(phase, now, now);
+}
+
+bool StartupTimeline::HasRecorded(Phase phase) const {
+  return recorded_mask_.load(std::memory_order_acquire) & GetPhaseBit(phase);
+}
+
+void StartupTimeline::Merge(const StartupTimeline& other) {
+  if (&other == this) {
+    return;
+  }
+  for (const auto& event : other.GetEvents()) {
+    Record(event.phase, event.begin_in_us, event.end_in_us);
+  }
+}
+
+std::vector<StartupTimeline::Event> StartupTimeline::GetEvents() const {
+  std::vector<Event> events;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    events = events_;
+  }
+  std::sort(events.begin(), events.end(), [](const Event& lhs, const Event& rhs) {
+    return lhs.begin_in_us < rhs.begin_in_us;
+  });
+  return events;
+}
+
+std::string StartupTimeline::ToChromeTraceJson() const {
+  std::ostringstream stream;
+  stream << "{\"traceEvents\":[";
+  std::vector<Event> events = GetEvents();
+  for (size_t i = 0; i < events.size(); ++i) {
+    const Event& event = events[i];
+    if (i) {
+      stream << ",";
+    }
+    stream << "{\"name\":\"" << GetPhaseName(event.phase)
+           << "\",\"cat\":\"startup\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+           << ",\"ts\":" << event.begin_in_us
+           << ",\"dur\":" << event.end_in_us - event.begin_in_us << "}";
+  }
+  stream << "],\"displayTimeUnit\":\"ms\"}";
+  return stream.str();
+}
+
+}  // namespace base
+}  // namespace hippy
@@ -22,9 +22,11 @@
 
 #include "core/base/task_runner.h"
 
+#include <algorithm>
+
 #include "base/logging.h"
 #include "core/base/base_time.h"
-#include "core/base/macros.h"
+#include "core/base/inline_task.h"
 #include "core/base/task.h"
 #include "core/base/thread_id.h"
 #include "core/napi/js_native_api.h"
@@ -32,11 +34,19 @@
 namespace hippy {
 namespace base {
 
-TaskRunner::TaskRunner() : Thread(Options("Task Runner")) {
+TaskRunner::TaskRunner() : TaskRunner(Options("Task Runner")) {}
+
+TaskRunner::TaskRunner(const Options& options)
+    : Thread(options), timer_wheel_(MonotonicallyIncreasingTime()) {
   is_terminated_ = false;
+  pending_task_count_ = 0;
+  telemetry_ = nullptr;
+  is_parked_ = false;
 }
 
-TaskRunner::~TaskRunner() = default;
+TaskRunner::~TaskRunner() {
+  delete telemetry_.load();
+}
 
 // when update this code, please update
 // JavaScriptTaskRunner::PauseThreadForInspector at the same time
@@ -48,30 +58,35 @@ void TaskRunner::Run() {
     }
     // TDF_BASE_DLOG(INFO) <<  "run task, id = %d", task->id_);
 
-    bool is_cancel;
-    {
-      std::lock_guard<std::mutex> lock(mutex_);
-      is_cancel = task->canceled_;
-    }
-    if (!is_cancel) {
-      task->Run();
+    if (!task->canceled_.load(std::memory_order_acquire)) {
+      RunTask(task.get());
     }
   }
 }
 
+void TaskRunner::RunTask(Task* task) {
+  TaskTelemetry* telemetry = telemetry_.load(std::memory_order_acquire);
+  if (!telemetry) {
+    task->Run();
+    return;
+  }
+  uint64_t start_time = telemetry->OnTaskStarted(task);
+  task->Run();
+  telemetry->OnTaskFinished(task, start_time);
+}
+
 void TaskRunner::Terminate() {
+  if (is_terminated_.exchange(true)) {
+    TDF_BASE_DLOG(INFO) << "TaskRunner has been terminated";
+    return;
+  }
+  if (this->Id() == hippy::base::ThreadId::GetCurrent()) {
+    TDF_BASE_DLOG(ERROR) << "terminate in task";
+    return;
+  }
   {
-    std::unique_lock<std::mutex> lock(mutex_);
-    TDF_BASE_DLOG(INFO) << "TaskRunner::Terminate task_queue_ size = " << task_queue_.size();
-    if (is_terminated_) {
-      TDF_BASE_DLOG(INFO) << "TaskRunner has been terminated";
-      return;
-    }
-    is_terminated_ = true;
-    if (this->Id() == hippy::base::ThreadId::GetCurrent()) {
-      TDF_BASE_DLOG(ERROR) << "terminate in task";
-      return;
-    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_parked_ = false;
   }
   cv_.notify_one();
   TDF_BASE_DLOG(INFO) << "TaskRunner Terminate join begin";
@@ -80,94 +95,244 @@ void TaskRunner::Terminate() {
 }
 
 void TaskRunner::PostTask(std::shared_ptr<Task> task) {
-  TDF_BASE_DLOG(INFO) << "TaskRunner::PostTask task id = " << task->id_;
-  std::lock_guard<std::mutex> lock(mutex_);
+  if (is_terminated_.load(std::memory_order_acquire)) {
+    return;
+  }
 
-  PostTaskNoLock(std::move(task));
+  task->runner_.store(this, std::memory_order_release);
+  size_t queue_depth = pending_task_count_.fetch_add(1, std::memory_order_relaxed);
+  TaskTelemetry* telemetry = telemetry_.load(std::memory_order_acquire);
+  if (telemetry) {
+    telemetry->OnTaskPosted(task.get(), queue_depth, 0);
+  }
+  incoming_queue_.Push({std::move(task), IncomingType::kTask, 0});
+  Unpark();
+}
 
-  cv_.notify_one();
+void TaskRunner::PostTask(InlineClosure closure, const char* source) {
+  if (is_terminated_.load(std::memory_order_acquire)) {
+    return;
+  }
+
+  std::shared_ptr<InlineTask> task = InlineTask::Create(std::move(closure));
+  task->source_ = source;
+  PostTask(std::move(task));
 }
 
 void TaskRunner::PostDelayedTask(
     std::shared_ptr<Task> task,
     TaskRunner::DelayedTimeInMs delay_in_milliseconds) {
-  std::lock_guard<std::mutex> lock(mutex_);
-
-  if (is_terminated_) {
+  if (is_terminated_.load(std::memory_order_acquire)) {
     return;
   }
 
   DelayedTimeInMs deadline = MonotonicallyIncreasingTime() + delay_in_milliseconds;
-  delayed_task_queue_.push(std::make_pair(deadline, std::move(task)));
-
-  cv_.notify_one();
+  task->runner_.store(this, std::memory_order_release);
+  size_t queue_depth = pending_task_count_.fetch_add(1, std::memory_order_relaxed);
+  TaskTelemetry* telemetry = telemetry_.load(std::memory_order_acquire);
+  if (telemetry) {
+    telemetry->OnTaskPosted(task.get(), queue_depth, delay_in_milliseconds * 1000);
+  }
+  incoming_queue_.Push({std::move(task), IncomingType::kDelayedTask, deadline});
+  Unpark();
 }
 
 void TaskRunner::CancelTask(const std::shared_ptr<Task>& task) {
-  std::lock_guard<std::mutex> lock(mutex_);
-
   if (!task) {
     return;
   }
-  task->canceled_ = true;
+  if (task->canceled_.exchange(true, std::memory_order_acq_rel) ||
+      is_terminated_.load(std::memory_order_acquire)) {
+    return;
+  }
+  // Only the runner the task was posted to may touch its bookkeeping, any
+  // other one leaves it to be skipped when it comes up. Not posted yet, it
+  // is dropped once posted.
+  TaskRunner* runner = task->runner_.load(std::memory_order_acquire);
+  TDF_BASE_DCHECK(!runner || runner == this) << "task canceled on another runner";
+  if (runner != this) {
+    return;
+  }
+  // The runner thread owns the timer wheel, let it unlink the task.
+  incoming_queue_.Push({task, IncomingType::kCancel, 0});
+  Unpark();
 }
 
-void TaskRunner::PostTaskNoLock(std::shared_ptr<Task> task) {
-  if (is_terminated_) {
-    return;
+size_t TaskRunner::GetPendingTaskCount() const {
+  return pending_task_count_.load(std::memory_order_relaxed);
+}
+
+TaskTelemetry* TaskRunner::EnableTelemetry() {
+  TaskTelemetry* telemetry = telemetry_.load(std::memory_order_acquire);
+  if (telemetry) {
+    return telemetry;
   }
+  TaskTelemetry* created = new TaskTelemetry();
+  if (!telemetry_.compare_exchange_strong(telemetry, created, std::memory_order_acq_rel)) {
+    delete created;
+    return telemetry;
+  }
+  return created;
+}
 
-  task_queue_.push(std::move(task));
+TaskTelemetry* TaskRunner::GetTelemetry() const {
+  return telemetry_.load(std::memory_order_acquire);
 }
 
-std::shared_ptr<Task> TaskRunner::GetNext() {
+#if defined(ENABLE_COROUTINE)
+void TaskRunner::ScheduleAwaiter::await_suspend(std::coroutine_handle<> handle) {
+  runner_->PostTask([handle] { handle.resume(); }, "Coroutine");
+}
+#endif
+
+void TaskRunner::Unpark() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!is_parked_.load(std::memory_order_relaxed) ||
+      !is_parked_.exchange(false)) {
+    return;
+  }
+  // Taking the lock orders this wakeup after the runner has started waiting.
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+  }
+  cv_.notify_one();
+}
+
+void TaskRunner::Park(DelayedTimeInMs now) {
+  is_parked_.store(true, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!incoming_queue_.Empty() || is_terminated_.load()) {
+    is_parked_ = false;
+    return;
+  }
+
+  DelayedTimeInMs wake_up_time =
+      std::min(GetNextWakeUpTime(now), timer_wheel_.NextExpiryTime());
+
   std::unique_lock<std::mutex> lock(mutex_);
+  auto is_unparked = [this] { return !is_parked_.load(); };
+  if (wake_up_time != kNoWakeUpTime) {
+    DelayedTimeInMs wait_in_ms = wake_up_time > now ? wake_up_time - now : 0;
+    cv_.wait_for(lock, std::chrono::milliseconds(wait_in_ms), is_unparked);
+  } else {
+    cv_.wait(lock, is_unparked);
+  }
+  is_parked_ = false;
+}
 
-  for (;;) {
-    DelayedTimeInMs now = MonotonicallyIncreasingTime();
-    std::shared_ptr<Task> task = popTaskFromDelayedQueueNoLock(now);
-    while (task) {
-      PostTaskNoLock(std::move(task));
-      task = popTaskFromDelayedQueueNoLock(now);
-    }
+std::shared_ptr<Task> TaskRunner::GetNextUrgentTask(DelayedTimeInMs now) {
+  return nullptr;
+}
 
-    if (!task_queue_.empty()) {
-      std::shared_ptr<Task> result = std::move(task_queue_.front());
-      task_queue_.pop();
-      return result;
-    }
+std::shared_ptr<Task> TaskRunner::GetNextIdleTask(DelayedTimeInMs now) {
+  return nullptr;
+}
 
-    if (is_terminated_) {
-      TDF_BASE_DLOG(INFO) << "TaskRunner terminate";
-      return nullptr;
+TaskRunner::DelayedTimeInMs TaskRunner::GetNextWakeUpTime(DelayedTimeInMs now) {
+  return kNoWakeUpTime;
+}
+
+void TaskRunner::DrainIncomingQueue() {
+  IncomingEntry entry;
+  while (incoming_queue_.Pop(entry)) {
+    Task* task = entry.task.get();
+    switch (entry.type) {
+      case IncomingType::kTask:
+        if (task->canceled_.load(std::memory_order_acquire)) {
+          task->OnCanceled();
+          pending_task_count_.fetch_sub(1, std::memory_order_relaxed);
+          break;
+        }
+        ++task->queued_count_;
+        task_queue_.push(std::move(entry.task));
+        break;
+      case IncomingType::kDelayedTask:
+        if (task->canceled_.load(std::memory_order_acquire)) {
+          task->OnCanceled();
+          pending_task_count_.fetch_sub(1, std::memory_order_relaxed);
+          break;
+        }
+        if (task->timer_node_) {
+          // Posted again while still pending, keep the latest deadline only.
+          timer_wheel_.Cancel(task->timer_node_);
+          pending_task_count_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        task->timer_node_ = timer_wheel_.Insert(entry.deadline, std::move(entry.task));
+        break;
+      case IncomingType::kCancel:
+        RemoveCanceledTask(task);
+        break;
     }
+    entry.task.reset();
+  }
+}
+
+void TaskRunner::RemoveCanceledTask(Task* task) {
+  // Posted to another runner since the cancel was queued.
+  if (task->runner_.load(std::memory_order_acquire) != this) {
+    return;
+  }
+  size_t removed_count = task->queued_count_;
+  if (task->timer_node_ && task->timer_node_->wheel == &timer_wheel_) {
+    timer_wheel_.Cancel(task->timer_node_);
+    task->timer_node_ = nullptr;
+    ++removed_count;
+  }
+  if (!removed_count) {
+    return;
+  }
+  // Entries left in `task_queue_` are skipped once `queued_count_` is zero.
+  task->queued_count_ = 0;
+  task->OnCanceled();
+  pending_task_count_.fetch_sub(removed_count, std::memory_order_relaxed);
+}
+
+std::shared_ptr<Task> TaskRunner::TakeNext() {
+  DrainIncomingQueue();
+
+  DelayedTimeInMs now = MonotonicallyIncreasingTime();
+  timer_wheel_.Advance(now);
+  std::shared_ptr<Task> task = timer_wheel_.PopExpired();
+  while (task) {
+    task->timer_node_ = nullptr;
+    ++task->queued_count_;
+    task_queue_.push(std::move(task));
+    task = timer_wheel_.PopExpired();
+  }
 
-    if (task_queue_.empty() && !delayed_task_queue_.empty()) {
-      const DelayedEntry& delayed_task = delayed_task_queue_.top();
-      DelayedTimeInMs wait_in_ms = delayed_task.first - now;
-      bool notified =
-          cv_.wait_for(lock, std::chrono::milliseconds(wait_in_ms)) ==
-          std::cv_status::timeout;
-      HIPPY_USE(notified);
-    } else {
-      cv_.wait(lock);
+  task = GetNextUrgentTask(now);
+  if (task) {
+    return task;
+  }
+
+  while (!task_queue_.empty()) {
+    std::shared_ptr<Task> result = std::move(task_queue_.front());
+    task_queue_.pop();
+    if (result->queued_count_ == 0) {
+      continue;
     }
+    --result->queued_count_;
+    pending_task_count_.fetch_sub(1, std::memory_order_relaxed);
+    return result;
   }
+
+  return GetNextIdleTask(now);
 }
 
-std::shared_ptr<Task> TaskRunner::popTaskFromDelayedQueueNoLock(
-    TaskRunner::DelayedTimeInMs now) {
-  if (delayed_task_queue_.empty())
-    return {};
+std::shared_ptr<Task> TaskRunner::GetNext() {
+  for (;;) {
+    std::shared_ptr<Task> task = TakeNext();
+    if (task) {
+      return task;
+    }
 
-  const DelayedEntry& deadline_and_task = delayed_task_queue_.top();
-  if (deadline_and_task.first > now)
-    return {};
+    if (is_terminated_.load(std::memory_order_acquire)) {
+      TDF_BASE_DLOG(INFO) << "TaskRunner terminate";
+      return nullptr;
+    }
 
-  std::shared_ptr<Task> result =
-      std::move(const_cast<DelayedEntry&>(deadline_and_task).second);
-  delayed_task_queue_.pop();
-  return result;
+    Park(MonotonicallyIncreasingTime());
+  }
 }
 
 }  // namespace base
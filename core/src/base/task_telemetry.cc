@@ -0,0 +1,154 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "core/base/task_telemetry.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "core/base/base_time.h"
+#include "core/base/task.h"
+
+namespace {
+
+constexpr char kDefaultSource[] = "default";
+constexpr char kOtherSource[] = "other";
+
+size_t GetBucketIndex(uint64_t value) {
+  if (value == 0) {
+    return 0;
+  }
+  size_t index = 64 - static_cast<size_t>(__builtin_clzll(value));
+  return index < hippy::base::Histogram::kBucketCount
+             ? index
+             : hippy::base::Histogram::kBucketCount - 1;
+}
+
+}  // namespace
+
+namespace hippy {
+namespace base {
+
+uint64_t Histogram::Snapshot::Percentile(double percentile) const {
+  if (count == 0) {
+    return 0;
+  }
+  uint64_t rank = static_cast<uint64_t>(static_cast<double>(count) * percentile / 100);
+  uint64_t seen = 0;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    seen += buckets[i];
+    if (seen > rank) {
+      return i == 0 ? 0 : std::min<uint64_t>(max, (uint64_t{1} << i) - 1);
+    }
+  }
+  return max;
+}
+
+void Histogram::Record(uint64_t value) {
+  buckets_[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  sum_.fetch_add(value, std::memory_order_relaxed);
+  uint64_t max = max_.load(std::memory_order_relaxed);
+  while (value > max &&
+         !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+  }
+}
+
+// Counters are read one by one, the snapshot may be off by a few records
+// that land while it is taken.
+Histogram::Snapshot Histogram::GetSnapshot() const {
+  Snapshot snapshot;
+  snapshot.count = count_.load(std::memory_order_relaxed);
+  snapshot.sum = sum_.load(std::memory_order_relaxed);
+  snapshot.max = max_.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+  }
+  return snapshot;
+}
+
+void TaskTelemetry::OnTaskPosted(Task* task, size_t queue_depth, uint64_t delay_in_us) {
+  task->post_time_in_us_ = MonotonicallyIncreasingTimeInUs() + delay_in_us;
+  if (post_count_.fetch_add(1, std::memory_order_relaxed) % kQueueDepthSampleInterval == 0) {
+    GetSource(task->source_).queue_depth.Record(queue_depth);
+  }
+}
+
+uint64_t TaskTelemetry::OnTaskStarted(const Task* task) {
+  uint64_t now = MonotonicallyIncreasingTimeInUs();
+  // Tasks that did not go through a post, such as animation frame callbacks,
+  // have no latency to report.
+  if (task->post_time_in_us_ && now >= task->post_time_in_us_) {
+    GetSource(task->source_).latency_in_us.Record(now - task->post_time_in_us_);
+  }
+  return now;
+}
+
+void TaskTelemetry::OnTaskFinished(const Task* task, uint64_t start_time_in_us) {
+  uint64_t now = MonotonicallyIncreasingTimeInUs();
+  GetSource(task->source_).run_time_in_us.Record(now - start_time_in_us);
+}
+
+std::vector<TaskTelemetry::SourceSnapshot> TaskTelemetry::GetSnapshot() const {
+  std::vector<SourceSnapshot> snapshots;
+  for (const auto& source : sources_) {
+    const char* name = source.name.load(std::memory_order_acquire);
+    if (!name) {
+      break;
+    }
+    SourceSnapshot snapshot;
+    snapshot.source = name;
+    snapshot.latency_in_us = source.latency_in_us.GetSnapshot();
+    snapshot.run_time_in_us = source.run_time_in_us.GetSnapshot();
+    snapshot.queue_depth = source.queue_depth.GetSnapshot();
+    snapshots.push_back(std::move(snapshot));
+  }
+  return snapshots;
+}
+
+// Slots are claimed in order and never released, so a lookup can stop at the
+// first empty one.
+TaskTelemetry::Source& TaskTelemetry::GetSource(const char* name) {
+  if (!name) {
+    name = kDefaultSource;
+  }
+  for (size_t i = 0; i < kMaxSourceCount - 1; ++i) {
+    Source& source = sources_[i];
+    const char* current = source.name.load(std::memory_order_acquire);
+    if (!current) {
+      if (source.name.compare_exchange_strong(current, name, std::memory_order_acq_rel)) {
+        return source;
+      }
+    }
+    if (current == name || strcmp(current, name) == 0) {
+      return source;
+    }
+  }
+  Source& other = sources_[kMaxSourceCount - 1];
+  const char* current = nullptr;
+  other.name.compare_exchange_strong(current, kOtherSource, std::memory_order_acq_rel);
+  return other;
+}
+
+}  // namespace base
+}  // namespace hippy
@@ -22,6 +22,14 @@
 
 #include "core/base/thread.h"
 
+#include <errno.h>
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #include <climits>
 #include <cstdio>
 #include <cstring>
@@ -34,7 +42,8 @@ namespace base {
 
 static void* ThreadEntry(void* arg);
 
-Thread::Thread(const Options& options) : stack_size_(options.stack_size()) {
+Thread::Thread(const Options& options)
+    : stack_size_(options.stack_size()), scheduling_params_(options.scheduling_params()) {
   if (stack_size_ > 0 && static_cast<size_t>(stack_size_) < PTHREAD_STACK_MIN) {
     stack_size_ = PTHREAD_STACK_MIN;
   }
@@ -93,6 +102,7 @@ static void* ThreadEntry(void* arg) {
 
   auto* thread = reinterpret_cast<Thread*>(arg);
   SetThreadName(thread->name());
+  Thread::SetCurrentThreadSchedulingParams(thread->scheduling_params());
   thread->Run();
 
   return reinterpret_cast<void*>(+true);
@@ -102,5 +112,80 @@ ThreadId Thread::GetCurrent() {
   return ThreadId::GetCurrent();
 }
 
+bool Thread::SetCurrentThreadSchedulingParams(const SchedulingParams& params) {
+  bool result = true;
+  if (params.policy != SchedulingParams::kInherit) {
+    sched_param param{};
+    param.sched_priority = params.priority;
+    int ret = pthread_setschedparam(pthread_self(), params.policy, &param);
+    if (ret != 0) {
+      TDF_BASE_LOG(WARNING) << "pthread_setschedparam failed, policy = " << params.policy
+                            << ", priority = " << params.priority << ", ret = " << ret;
+      result = false;
+    }
+  }
+
+#if defined(__linux__)
+  // On Linux both calls act on a single thread when given its tid.
+  auto tid = static_cast<pid_t>(syscall(SYS_gettid));
+  if (params.nice != SchedulingParams::kInherit) {
+    if (setpriority(PRIO_PROCESS, static_cast<id_t>(tid), params.nice) != 0) {
+      TDF_BASE_LOG(WARNING) << "setpriority failed, nice = " << params.nice
+                            << ", errno = " << errno;
+      result = false;
+    }
+  }
+  if (params.cpu_affinity) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; ++cpu) {
+      if (params.cpu_affinity & (uint64_t{1} << cpu)) {
+        CPU_SET(cpu, &cpu_set);
+      }
+    }
+    if (sched_setaffinity(tid, sizeof(cpu_set), &cpu_set) != 0) {
+      TDF_BASE_LOG(WARNING) << "sched_setaffinity failed, mask = " << params.cpu_affinity
+                            << ", errno = " << errno;
+      result = false;
+    }
+  }
+#else
+  if (params.nice != SchedulingParams::kInherit || params.cpu_affinity) {
+    TDF_BASE_DLOG(WARNING) << "nice and cpu affinity are not supported on this platform";
+    result = false;
+  }
+#endif
+  return result;
+}
+
+Thread::SchedulingParams Thread::GetCurrentThreadSchedulingParams() {
+  SchedulingParams params;
+  int policy = 0;
+  sched_param param{};
+  if (pthread_getschedparam(pthread_self(), &policy, &param) == 0) {
+    params.policy = policy;
+    params.priority = param.sched_priority;
+  }
+
+#if defined(__linux__)
+  auto tid = static_cast<pid_t>(syscall(SYS_gettid));
+  errno = 0;
+  int nice = getpriority(PRIO_PROCESS, static_cast<id_t>(tid));
+  if (errno == 0) {
+    params.nice = nice;
+  }
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  if (sched_getaffinity(tid, sizeof(cpu_set), &cpu_set) == 0) {
+    for (int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &cpu_set)) {
+        params.cpu_affinity |= uint64_t{1} << cpu;
+      }
+    }
+  }
+#endif
+  return params;
+}
+
 }  // namespace base
 }  // namespace hippy
@@ -0,0 +1,254 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "core/base/timer_wheel.h"
+
+#include <utility>
+
+#include "base/logging.h"
+#include "core/base/task.h"
+
+namespace {
+
+constexpr size_t kMaxFreeNodeCount = 1024;
+
+inline uint32_t CountTrailingZeros(uint64_t value) {
+  return static_cast<uint32_t>(__builtin_ctzll(value));
+}
+
+}  // namespace
+
+namespace hippy {
+namespace base {
+
+TimerWheel::TimerWheel(TimeInMs now) : now_(now) {}
+
+TimerWheel::~TimerWheel() {
+  for (uint32_t level = 0; level <= kExpiredLevel; ++level) {
+    uint32_t slot_count = level < kLevelCount ? kSlotCount : 1;
+    for (uint32_t slot = 0; slot < slot_count; ++slot) {
+      TimerNode* node = GetList(level, slot).head;
+      while (node) {
+        TimerNode* next = node->next;
+        delete node;
+        node = next;
+      }
+    }
+  }
+  while (free_nodes_) {
+    TimerNode* next = free_nodes_->next;
+    delete free_nodes_;
+    free_nodes_ = next;
+  }
+}
+
+TimerNode* TimerWheel::Insert(TimeInMs deadline, std::shared_ptr<Task> task) {
+  TimerNode* node = AllocateNode();
+  node->wheel = this;
+  node->deadline = deadline;
+  node->task = std::move(task);
+  Place(node);
+  ++size_;
+  return node;
+}
+
+void TimerWheel::Cancel(TimerNode* node) {
+  TDF_BASE_DCHECK(node && node->wheel == this);
+  Unlink(node);
+  --size_;
+  FreeNode(node);
+}
+
+void TimerWheel::Advance(TimeInMs now) {
+  while (now_ < now) {
+    TimeInMs next = NextEventTime();
+    if (next > now) {
+      // Nothing fires or cascades before `now`, every node stays valid.
+      now_ = now;
+      break;
+    }
+    now_ = next;
+    if ((now_ & kSlotMask) == 0) {
+      // Entering a new level 0 block, pull in the matching coarser slots.
+      for (uint32_t level = 1; level < kLevelCount; ++level) {
+        uint32_t slot = static_cast<uint32_t>((now_ >> (level * kSlotBits)) & kSlotMask);
+        Cascade(level, slot);
+        if (slot != 0) {
+          break;
+        }
+        if (level == kLevelCount - 1) {
+          CascadeOverflow();
+        }
+      }
+    }
+    Cascade(0, static_cast<uint32_t>(now_ & kSlotMask));
+  }
+}
+
+std::shared_ptr<Task> TimerWheel::PopExpired() {
+  TimerNode* node = expired_.head;
+  if (!node) {
+    return nullptr;
+  }
+  Unlink(node);
+  --size_;
+  std::shared_ptr<Task> task = std::move(node->task);
+  FreeNode(node);
+  return task;
+}
+
+TimerWheel::TimeInMs TimerWheel::NextExpiryTime() const {
+  if (expired_.head) {
+    return now_;
+  }
+  return size_ ? NextEventTime() : kNoExpiryTime;
+}
+
+TimerWheel::List& TimerWheel::GetList(uint32_t level, uint32_t slot) {
+  if (level < kLevelCount) {
+    return slots_[level][slot];
+  }
+  return level == kOverflowLevel ? overflow_ : expired_;
+}
+
+void TimerWheel::Link(TimerNode* node, uint32_t level, uint32_t slot) {
+  List& list = GetList(level, slot);
+  node->level = level;
+  node->slot = slot;
+  node->next = nullptr;
+  node->prev = list.tail;
+  if (list.tail) {
+    list.tail->next = node;
+  } else {
+    list.head = node;
+  }
+  list.tail = node;
+  if (level < kLevelCount) {
+    occupied_[level] |= uint64_t{1} << slot;
+  }
+}
+
+void TimerWheel::Unlink(TimerNode* node) {
+  List& list = GetList(node->level, node->slot);
+  if (node->prev) {
+    node->prev->next = node->next;
+  } else {
+    list.head = node->next;
+  }
+  if (node->next) {
+    node->next->prev = node->prev;
+  } else {
+    list.tail = node->prev;
+  }
+  node->prev = nullptr;
+  node->next = nullptr;
+  if (node->level < kLevelCount && !list.head) {
+    occupied_[node->level] &= ~(uint64_t{1} << node->slot);
+  }
+}
+
+// A node lives at the lowest level whose current block contains its deadline,
+// so slots ahead of the wheel time never wrap around.
+void TimerWheel::Place(TimerNode* node) {
+  if (node->deadline <= now_) {
+    Link(node, kExpiredLevel, 0);
+    return;
+  }
+  uint64_t diff = node->deadline ^ now_;
+  for (uint32_t level = 0; level < kLevelCount; ++level) {
+    if ((diff >> ((level + 1) * kSlotBits)) == 0) {
+      uint32_t slot = static_cast<uint32_t>((node->deadline >> (level * kSlotBits)) & kSlotMask);
+      Link(node, level, slot);
+      return;
+    }
+  }
+  Link(node, kOverflowLevel, 0);
+}
+
+void TimerWheel::Cascade(uint32_t level, uint32_t slot) {
+  List& list = slots_[level][slot];
+  TimerNode* node = list.head;
+  list.head = nullptr;
+  list.tail = nullptr;
+  occupied_[level] &= ~(uint64_t{1} << slot);
+  while (node) {
+    TimerNode* next = node->next;
+    Place(node);
+    node = next;
+  }
+}
+
+void TimerWheel::CascadeOverflow() {
+  TimerNode* node = overflow_.head;
+  overflow_.head = nullptr;
+  overflow_.tail = nullptr;
+  while (node) {
+    TimerNode* next = node->next;
+    Place(node);
+    node = next;
+  }
+}
+
+// The earliest time at which a level 0 slot fires or a coarser slot cascades.
+TimerWheel::TimeInMs TimerWheel::NextEventTime() const {
+  for (uint32_t level = 0; level < kLevelCount; ++level) {
+    uint32_t shift = level * kSlotBits;
+    uint32_t current = static_cast<uint32_t>((now_ >> shift) & kSlotMask);
+    uint64_t ahead = current == kSlotMask ? 0 : occupied_[level] & (~uint64_t{0} << (current + 1));
+    if (ahead) {
+      TimeInMs block_mask = (TimeInMs{1} << (shift + kSlotBits)) - 1;
+      return (now_ & ~block_mask) | (TimeInMs{CountTrailingZeros(ahead)} << shift);
+    }
+  }
+  if (overflow_.head) {
+    uint32_t shift = kLevelCount * kSlotBits;
+    return ((now_ >> shift) + 1) << shift;
+  }
+  return kNoExpiryTime;
+}
+
+TimerNode* TimerWheel::AllocateNode() {
+  if (!free_nodes_) {
+    return new TimerNode();
+  }
+  TimerNode* node = free_nodes_;
+  free_nodes_ = node->next;
+  --free_node_count_;
+  node->next = nullptr;
+  return node;
+}
+
+void TimerWheel::FreeNode(TimerNode* node) {
+  node->task.reset();
+  node->wheel = nullptr;
+  if (free_node_count_ >= kMaxFreeNodeCount) {
+    delete node;
+    return;
+  }
+  node->prev = nullptr;
+  node->next = free_nodes_;
+  free_nodes_ = node;
+  ++free_node_count_;
+}
+
+}  // namespace base
+}  // namespace hippy
@@ -24,6 +24,8 @@
 
 #include "core/scope.h"
 #include "core/task/javascript_task.h"
+#include "core/task/javascript_thread_pool.h"
+#include "core/task/shared_worker_pool.h"
 
 constexpr uint32_t Engine::kDefaultWorkerPoolSize = 1;
 
@@ -31,12 +33,26 @@ Engine::Engine() : vm_(nullptr), scope_cnt_(0) {}
 
 Engine::~Engine() {
   TDF_BASE_DLOG(INFO) << "~Engine";
+  // Released by TerminateRunner, on the JS thread.
+  TDF_BASE_DCHECK(!recycled_scope_ && !warm_context_) << "JS objects outlive the runner";
   std::lock_guard<std::mutex> lock(cnt_mutex_);
   TDF_BASE_DCHECK(scope_cnt_ == 0) << "this engine is in use";
 }
 
 void Engine::TerminateRunner() {
   TDF_BASE_DLOG(INFO) << "~TerminateRunner";
+  // The last task to run, the recycled scope is counted by Enter as long as
+  // it lives, and both hold JS objects.
+  std::weak_ptr<Engine> weak_engine = weak_from_this();
+  auto task = std::make_shared<JavaScriptTask>();
+  task->callback = [weak_engine] {
+    auto engine = weak_engine.lock();
+    if (engine) {
+      engine->recycled_scope_ = nullptr;
+      engine->warm_context_ = nullptr;
+    }
+  };
+  js_runner_->PostTask(std::move(task));
   js_runner_->Terminate();
   worker_task_runner_->Terminate();
 }
@@ -62,15 +78,86 @@ std::shared_ptr<Scope> Engine::CreateScope(const std::string& name,
 
 void Engine::SetupThreads() {
   TDF_BASE_DLOG(INFO) << "Engine SetupThreads";
-  js_runner_ = std::make_shared<JavaScriptTaskRunner>();
-  js_runner_->Start();
+  if (thread_config_.use_shared_js_thread_pool) {
+    js_runner_ = std::make_shared<JavaScriptTaskRunner>(JavaScriptThreadPool::GetInstance());
+    std::weak_ptr<Engine> weak_engine = weak_from_this();
+    js_runner_->SetSliceCallbacks(
+        [weak_engine] {
+          auto engine = weak_engine.lock();
+          if (engine && engine->vm_) {
+            engine->vm_->EnterThread();
+          }
+        },
+        [weak_engine] {
+          auto engine = weak_engine.lock();
+          if (engine && engine->vm_) {
+            engine->vm_->ExitThread();
+          }
+        });
+  } else {
+    js_runner_ = std::make_shared<JavaScriptTaskRunner>(thread_config_.js_thread);
+    js_runner_->Start();
+  }
+
+  if (thread_config_.use_shared_worker_pool) {
+    worker_task_runner_ = std::make_shared<WorkerTaskRunner>(SharedWorkerPool::GetInstance());
+  } else {
+    worker_task_runner_ = std::make_shared<WorkerTaskRunner>(kDefaultWorkerPoolSize,
+                                                             thread_config_.worker_thread);
+  }
+}
 
-  worker_task_runner_ = std::make_shared<WorkerTaskRunner>(kDefaultWorkerPoolSize);
+// Runs on the JS thread, first thing after it starts.
+void Engine::BeginStartupBoost() {
+  const SchedulingParams& boost = thread_config_.js_startup_boost;
+  SchedulingParams current = hippy::base::Thread::GetCurrentThreadSchedulingParams();
+  // Only remember what the boost is going to change.
+  params_before_boost_ = SchedulingParams();
+  if (boost.nice != SchedulingParams::kInherit) {
+    params_before_boost_.nice = current.nice;
+  }
+  if (boost.policy != SchedulingParams::kInherit) {
+    params_before_boost_.policy = current.policy;
+    params_before_boost_.priority = current.priority;
+  }
+  if (boost.cpu_affinity) {
+    params_before_boost_.cpu_affinity = current.cpu_affinity;
+  }
+  hippy::base::Thread::SetCurrentThreadSchedulingParams(boost);
+  is_startup_boosted_ = true;
+  TDF_BASE_DLOG(INFO) << "Engine startup boost begin";
+}
+
+void Engine::EndStartupBoost() {
+  auto weak_engine = weak_from_this();
+  auto restore = [weak_engine] {
+    auto engine = weak_engine.lock();
+    if (!engine || !engine->is_startup_boosted_) {
+      return;
+    }
+    engine->is_startup_boosted_ = false;
+    hippy::base::Thread::SetCurrentThreadSchedulingParams(engine->params_before_boost_);
+    TDF_BASE_DLOG(INFO) << "Engine startup boost end";
+  };
+  if (js_runner_->IsJsThread()) {
+    restore();
+  } else {
+    js_runner_->PostTask(std::move(restore));
+  }
 }
 
 void Engine::CreateVM(const std::shared_ptr<VMInitParam>& param) {
   TDF_BASE_DLOG(INFO) << "Engine CreateVM";
-  vm_ = hippy::napi::CreateVM(param);
+  {
+    hippy::base::StartupTimeline::ScopedPhase phase(
+        &startup_timeline_, hippy::base::StartupTimeline::Phase::kIsolateCreation);
+    // Created in a slice, locked and entered like the slices to come.
+    vm_ = hippy::napi::CreateVM(param, thread_config_.use_shared_js_thread_pool);
+  }
+  RunVMCreatedCallback();
+}
+
+void Engine::RunVMCreatedCallback() {
   auto it = map_->find(hippy::base::kVMCreateCBKey);
   if (it != map_->end()) {
     RegisterFunction f = it->second;
@@ -88,6 +175,23 @@ void Engine::AsyncInit(const std::shared_ptr<VMInitParam>& param, std::unique_pt
 
   map_ = std::move(map);
   auto weak_engine = weak_from_this();
+  if (thread_config_.startup_boost_duration_in_ms && !thread_config_.use_shared_js_thread_pool) {
+    js_runner_->PostTask([weak_engine] {
+      auto engine = weak_engine.lock();
+      if (engine) {
+        engine->BeginStartupBoost();
+      }
+    });
+    auto timeout = std::make_shared<JavaScriptTask>();
+    timeout->callback = [weak_engine] {
+      auto engine = weak_engine.lock();
+      if (engine) {
+        engine->EndStartupBoost();
+      }
+    };
+    js_runner_->PostDelayedTask(std::move(timeout), thread_config_.startup_boost_duration_in_ms);
+  }
+
   auto task = std::make_shared<JavaScriptTask>();
   task->callback = [weak_engine, param] {
     auto engine = weak_engine.lock();
@@ -100,6 +204,49 @@ void Engine::AsyncInit(const std::shared_ptr<VMInitParam>& param, std::unique_pt
   js_runner_->PostTask(task);
 }
 
+void Engine::Adopt(std::unique_ptr<RegisterMap> map) {
+  TDF_BASE_DLOG(INFO) << "Engine Adopt";
+  // std::function must be copyable.
+  std::shared_ptr<RegisterMap> shared_map = std::move(map);
+  auto weak_engine = weak_from_this();
+  auto task = std::make_shared<JavaScriptTask>();
+  task->callback = [weak_engine, shared_map] {
+    auto engine = weak_engine.lock();
+    if (!engine) {
+      return;
+    }
+    engine->map_ = std::make_unique<RegisterMap>(std::move(*shared_map));
+    engine->RunVMCreatedCallback();
+  };
+  js_runner_->PostTask(task);
+}
+
+void Engine::PrewarmContext() {
+  auto weak_engine = weak_from_this();
+  auto task = std::make_shared<JavaScriptTask>();
+  task->callback = [weak_engine] {
+    auto engine = weak_engine.lock();
+    if (!engine || !engine->vm_) {
+      return;
+    }
+    TDF_BASE_DLOG(INFO) << "Engine PrewarmContext";
+    engine->warm_context_ = engine->vm_->CreateContext();
+  };
+  js_runner_->PostTask(task);
+}
+
+std::shared_ptr<hippy::napi::Ctx> Engine::TakeWarmContext() {
+  return std::move(warm_context_);
+}
+
+void Engine::KeepRecycledScope(std::shared_ptr<Scope> scope) {
+  recycled_scope_ = std::move(scope);
+}
+
+std::shared_ptr<Scope> Engine::TakeRecycledScope() {
+  return std::move(recycled_scope_);
+}
+
 void Engine::Enter() {
   TDF_BASE_DLOG(INFO) << "Engine Enter";
   std::lock_guard<std::mutex> lock(cnt_mutex_);
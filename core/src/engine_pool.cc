@@ -0,0 +1,160 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "core/engine_pool.h"
+
+#include <utility>
+
+#include "base/logging.h"
+#include "core/task/common_task.h"
+#include "core/task/javascript_task.h"
+#include "core/task/shared_worker_pool.h"
+
+EnginePool::EnginePool(const Config& config)
+    : config_(config),
+      refill_runner_(std::make_shared<WorkerTaskRunner>(SharedWorkerPool::GetInstance())) {}
+
+EnginePool::~EnginePool() {
+  refill_runner_->Terminate();
+  Trim();
+}
+
+void EnginePool::Refill() {
+  uint32_t trim_count;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (is_refilling_ || IsFull()) {
+      return;
+    }
+    is_refilling_ = true;
+    trim_count = trim_count_;
+  }
+  std::weak_ptr<EnginePool> weak_pool = weak_from_this();
+  auto task = std::make_unique<CommonTask>();
+  task->func_ = [weak_pool, trim_count] {
+    auto pool = weak_pool.lock();
+    if (pool) {
+      pool->RunRefill(trim_count);
+    }
+  };
+  refill_runner_->PostTask(std::move(task));
+}
+
+void EnginePool::RunRefill(uint32_t trim_count) {
+  while (true) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (trim_count != trim_count_ || IsFull()) {
+        is_refilling_ = false;
+        return;
+      }
+    }
+    TDF_BASE_DLOG(INFO) << "EnginePool warm engine";
+    auto engine = std::make_shared<Engine>();
+    engine->SetThreadConfig(config_.thread_config);
+    engine->AsyncInit(config_.vm_init_param);
+    engine->PrewarmContext();
+    auto heap_size = std::make_shared<std::atomic<size_t>>(0);
+    // Does not reference the pool, the engine may be acquired by then.
+    std::weak_ptr<Engine> weak_engine = engine;
+    auto task = std::make_shared<JavaScriptTask>();
+    task->callback = [weak_engine, heap_size] {
+      auto warm_engine = weak_engine.lock();
+      if (warm_engine && warm_engine->GetVM()) {
+        heap_size->store(warm_engine->GetVM()->GetUsedHeapSize(), std::memory_order_relaxed);
+      }
+    };
+    engine->GetJSRunner()->PostTask(task);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (trim_count == trim_count_) {
+        idle_.push_back({std::move(engine), std::move(heap_size)});
+        continue;
+      }
+      is_refilling_ = false;
+    }
+    // Trimmed while the engine was being created, it must not outlive the trim.
+    engine->TerminateRunner();
+    return;
+  }
+}
+
+std::shared_ptr<Engine> EnginePool::Acquire() {
+  std::shared_ptr<Engine> engine;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!idle_.empty()) {
+      engine = std::move(idle_.front().engine);
+      idle_.pop_front();
+    }
+  }
+  TDF_BASE_DLOG(INFO) << "EnginePool Acquire, hit = " << (engine != nullptr);
+  Refill();
+  return engine;
+}
+
+void EnginePool::Trim() {
+  std::deque<Entry> idle;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    idle.swap(idle_);
+    ++trim_count_;
+  }
+  for (auto& entry : idle) {
+    entry.engine->TerminateRunner();
+  }
+}
+
+size_t EnginePool::GetIdleCount() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return idle_.size();
+}
+
+size_t EnginePool::GetIdleHeapSize() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return GetIdleHeapSizeLocked();
+}
+
+bool EnginePool::IsFull() {
+  if (idle_.size() >= config_.capacity) {
+    return true;
+  }
+  if (!config_.max_heap_size_in_bytes) {
+    return false;
+  }
+  return GetIdleHeapSizeLocked() + heap_size_estimate_ > config_.max_heap_size_in_bytes;
+}
+
+size_t EnginePool::GetIdleHeapSizeLocked() {
+  size_t total = 0;
+  for (const auto& entry : idle_) {
+    size_t size = entry.heap_size->load(std::memory_order_relaxed);
+    if (size) {
+      heap_size_estimate_ = size;
+    } else {
+      size = heap_size_estimate_;
+    }
+    total += size;
+  }
+  return total;
+}
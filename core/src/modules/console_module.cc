@@ -61,7 +61,7 @@ void ConsoleModule::Log(const hippy::napi::CallbackInfo& info) { // NOLINT(reada
   TDF_BASE_CHECK(context);
 
   unicode_string_view message;
-  if (!context->GetValueString(info[0], &message)) {
+  if (!context->GetValueString(info.GetLocalValue(0), &message)) {
     info.GetExceptionValue()->Set(context,
                                   "The first argument must be string.");
     return;
@@ -72,7 +72,7 @@ void ConsoleModule::Log(const hippy::napi::CallbackInfo& info) { // NOLINT(reada
     TDF_BASE_LOG(INFO) << view_msg;
   } else {
     unicode_string_view view_type;
-    if (!context->GetValueString(info[1], &view_type) ||
+    if (!context->GetValueString(info.GetLocalValue(1), &view_type) ||
         StringViewUtils::IsEmpty(view_type)) {
       info.GetExceptionValue()->Set(
           context, "The second argument must be non-empty string.");
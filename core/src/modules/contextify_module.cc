@@ -27,6 +27,7 @@
 #include <string>
 
 #include "base/logging.h"
+#include "core/base/code_cache_store.h"
 #include "core/base/uri_loader.h"
 #include "core/modules/module_register.h"
 #include "core/napi/js_native_api.h"
@@ -48,6 +49,7 @@ using CallbackInfo = hippy::napi::CallbackInfo;
 using TryCatch = hippy::napi::TryCatch;
 using UriLoader = hippy::base::UriLoader;
 using StringViewUtils = hippy::base::StringViewUtils;
+using CodeCacheStore = hippy::base::CodeCacheStore;
 
 void ContextifyModule::RunInThisContext(const hippy::napi::CallbackInfo& info) { // NOLINT(readability-convert-member-functions-to-static)
 #ifdef JS_V8
@@ -65,6 +67,11 @@ void ContextifyModule::RunInThisContext(const hippy::napi::CallbackInfo& info) {
   }
 
   TDF_BASE_DLOG(INFO) << "RunInThisContext key = " << key;
+  std::shared_ptr<CtxValue> function = context->GetNativeSourceFunction(key);
+  if (function) {
+    info.GetReturnValue()->Set(function);
+    return;
+  }
   const auto& source_code =
       hippy::GetNativeSourceCode(StringViewUtils::ToU8StdStr(key));
   std::shared_ptr<TryCatch> try_catch = CreateTryCatchScope(true, context);
@@ -88,6 +95,41 @@ void ContextifyModule::RemoveCBFunc(const unicode_string_view& uri) {
   cb_func_map_.erase(uri);
 }
 
+// Runs a dynamically loaded chunk with the code cache found under its content
+// hash, or caches it under its uri when there was none.
+static void RunChunk(const std::shared_ptr<Scope>& scope,
+                     const unicode_string_view& code,
+                     const unicode_string_view& file_name,
+                     const unicode_string_view& uri,
+                     const std::shared_ptr<CodeCacheStore>& code_cache_store,
+                     const std::string& code_cache_key,
+                     const std::shared_ptr<CodeCacheStore::Data>& code_cache) {
+#ifdef JS_V8
+  auto context = std::static_pointer_cast<hippy::napi::V8Ctx>(scope->GetContext());
+  hippy::napi::V8Ctx::CodeCacheRequest code_cache_request;
+  context->RunScriptWithCodeCache(code, file_name,
+                                  code_cache ? code_cache->data() : nullptr,
+                                  code_cache ? code_cache->size() : 0,
+                                  &code_cache_request);
+  if (!code_cache_request.is_needed || code_cache_request.code_cache.empty()) {
+    return;
+  }
+  std::unique_ptr<CommonTask> task = std::make_unique<CommonTask>();
+  task->func_ = [code_cache_store, code_cache_key, name = StringViewUtils::ToU8StdStr(uri),
+                 new_code_cache = std::move(code_cache_request.code_cache)] {
+    bool save_file_ret = code_cache_store->Put(
+        code_cache_key, name, reinterpret_cast<const uint8_t*>(new_code_cache.c_str()),
+        new_code_cache.length());
+    TDF_BASE_DLOG(INFO) << "chunk code cache save_file_ret = " << save_file_ret
+                        << ", name = " << name;
+    HIPPY_USE(save_file_ret);
+  };
+  scope->GetWorkerTaskRunner()->PostTask(std::move(task));
+#else
+  scope->RunJS(code, file_name);
+#endif
+}
+
 void ContextifyModule::LoadUntrustedContent(const CallbackInfo& info) {
   std::shared_ptr<Scope> scope = info.GetScope();
   std::shared_ptr<hippy::napi::Ctx> context = scope->GetContext();
@@ -122,9 +164,11 @@ void ContextifyModule::LoadUntrustedContent(const CallbackInfo& info) {
 
   std::weak_ptr<Scope> weak_scope = scope;
   std::weak_ptr<hippy::napi::CtxValue> weak_function = function;
+  // Chunks share the code cache of the main bundle, see RunChunk.
+  std::shared_ptr<CodeCacheStore> code_cache_store = scope->GetCodeCacheStore();
 
   std::function<void(u8string)> cb = [this, weak_scope, weak_function, encode,
-                                      uri](u8string code) {
+                                      uri, code_cache_store](u8string code) {
     std::shared_ptr<Scope> scope = weak_scope.lock();
     if (!scope) {
       return;
@@ -149,13 +193,23 @@ void ContextifyModule::LoadUntrustedContent(const CallbackInfo& info) {
                           << ", encode = " << encode
                           << ", code = " << unicode_string_view(code);
     }
+    // Hashed and mapped here, off the JS thread.
+    std::string code_cache_key;
+    std::shared_ptr<CodeCacheStore::Data> code_cache;
+    if (code_cache_store && !code.empty()) {
+      CodeCacheStore::Hasher hasher;
+      hasher.Update(code.c_str(), code.length());
+      code_cache_key = code_cache_store->MakeKey(hasher.Finish());
+      code_cache = code_cache_store->Get(code_cache_key);
+    }
     std::shared_ptr<JavaScriptTask> js_task =
         std::make_shared<JavaScriptTask>();
     js_task->callback = [this, weak_scope, weak_function,
                          move_code = std::move(code), cur_dir, file_name,
-                         uri]() {
+                         uri, code_cache_store, code_cache_key, code_cache]() {
       std::shared_ptr<Scope> scope = weak_scope.lock();
-      if (!scope) {
+      // This module is gone with the page of a recycled scope.
+      if (!scope || scope->IsRecycled()) {
         return;
       }
 
@@ -169,7 +223,12 @@ void ContextifyModule::LoadUntrustedContent(const CallbackInfo& info) {
             CreateTryCatchScope(true, scope->GetContext());
         try_catch->SetVerbose(true);
         unicode_string_view view_code(move_code);
-        scope->RunJS(view_code, file_name);
+        if (code_cache_store) {
+          RunChunk(scope, view_code, file_name, uri, code_cache_store, code_cache_key,
+                   code_cache);
+        } else {
+          scope->RunJS(view_code, file_name);
+        }
         ctx->SetGlobalObjVar("__HIPPYCURDIR__", last_dir_str_obj,
                              hippy::napi::PropertyAttribute::None);
         unicode_string_view view_last_dir_str;
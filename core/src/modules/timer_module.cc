@@ -26,6 +26,7 @@
 #include "core/base/common.h"
 #include "core/base/string_view_utils.h"
 #include "core/modules/module_register.h"
+#include "core/task/idle_task.h"
 #include "core/task/javascript_task.h"
 #include "core/task/javascript_task_runner.h"
 
@@ -33,21 +34,37 @@ REGISTER_MODULE(TimerModule, SetTimeout) // NOLINT(cert-err58-cpp)
 REGISTER_MODULE(TimerModule, ClearTimeout) // NOLINT(cert-err58-cpp)
 REGISTER_MODULE(TimerModule, SetInterval) // NOLINT(cert-err58-cpp)
 REGISTER_MODULE(TimerModule, ClearInterval) // NOLINT(cert-err58-cpp)
+REGISTER_MODULE(TimerModule, RequestIdleCallback) // NOLINT(cert-err58-cpp)
+REGISTER_MODULE(TimerModule, CancelIdleCallback) // NOLINT(cert-err58-cpp)
 
 namespace napi = ::hippy::napi;
 
 using unicode_string_view = tdf::base::unicode_string_view;
 using Ctx = hippy::napi::Ctx;
 using CtxValue = hippy::napi::CtxValue;
+using CtxLocalValue = hippy::napi::CtxLocalValue;
 using RegisterFunction = hippy::base::RegisterFunction;
 using RegisterMap = hippy::base::RegisterMap;
 
 TimerModule::TimerModule() = default;
 
-TimerModule::~TimerModule() = default;
+// Cancels what is still pending, the callbacks refer to this module, e.g.
+// when Scope::Recycle drops the modules of a page.
+TimerModule::~TimerModule() {
+  std::shared_ptr<JavaScriptTaskRunner> runner = runner_.lock();
+  if (!runner) {
+    return;
+  }
+  for (const auto& item : task_map_) {
+    std::shared_ptr<hippy::base::Task> task = item.second->task.lock();
+    if (task) {
+      runner->CancelTask(task);
+    }
+  }
+}
 
 void TimerModule::SetTimeout(const napi::CallbackInfo& info) {
-  info.GetReturnValue()->Set(Start(info, false));
+  info.GetReturnValue()->SetLocal(Start(info, false));
 }
 
 void TimerModule::ClearTimeout(const napi::CallbackInfo& info) {
@@ -55,7 +72,7 @@ void TimerModule::ClearTimeout(const napi::CallbackInfo& info) {
 }
 
 void TimerModule::SetInterval(const napi::CallbackInfo& info) {
-  info.GetReturnValue()->Set(Start(info, true));
+  info.GetReturnValue()->SetLocal(Start(info, true));
 }
 
 void TimerModule::ClearInterval(const napi::CallbackInfo& info) {
@@ -64,41 +81,101 @@ void TimerModule::ClearInterval(const napi::CallbackInfo& info) {
   TDF_BASE_CHECK(context);
 
   int32_t argument1 = 0;
-  if (!context->GetValueNumber(info[0], &argument1)) {
+  if (!context->GetValueNumber(info.GetLocalValue(0), &argument1)) {
     info.GetExceptionValue()->Set(context, "The first argument must be int32.");
     return;
   }
 
   TaskId task_id = hippy::base::checked_numeric_cast<int32_t, TaskId>(argument1);
   Cancel(task_id, scope);
-  info.GetReturnValue()->Set(context->CreateNumber(task_id));
+  info.GetReturnValue()->SetLocal(context->CreateNumberLocal(task_id));
+}
+
+void TimerModule::RequestIdleCallback(const napi::CallbackInfo& info) {
+  std::shared_ptr<Scope> scope = info.GetScope();
+  std::shared_ptr<Ctx> context = scope->GetContext();
+  TDF_BASE_CHECK(context);
+
+  CtxLocalValue function = info.GetLocalValue(0);
+  if (!context->IsFunction(function)) {
+    info.GetExceptionValue()->Set(context,
+                                  "The first argument must be function.");
+    return;
+  }
+
+  double number = 0;
+  context->GetValueNumber(info.GetLocalValue(1), &number);
+  hippy::base::TaskRunner::DelayedTimeInMs timeout =
+      static_cast<hippy::base::TaskRunner::DelayedTimeInMs>(
+          std::max(.0, number));
+
+  std::shared_ptr<IdleTask> task = std::make_shared<IdleTask>();
+  task->source_ = "IdleCallback";
+  std::weak_ptr<IdleTask> weak_task = task;
+  std::weak_ptr<Scope> weak_scope = scope;
+  std::shared_ptr<TaskEntry> entry =
+      std::make_shared<TaskEntry>(context->GlobalizeLocal(function), task);
+  std::weak_ptr<CtxValue> weak_function = entry->func;
+
+  task->callback = [this, weak_scope, weak_function, weak_task](
+      const IdleTask::Deadline& deadline) {
+    std::shared_ptr<Scope> scope = weak_scope.lock();
+    if (!scope) {
+      return;
+    }
+    std::shared_ptr<CtxValue> function = weak_function.lock();
+    if (function) {
+      std::shared_ptr<hippy::napi::Ctx> context = scope->GetContext();
+      std::shared_ptr<CtxValue> argv[] = {
+          context->CreateNumber(static_cast<double>(deadline.time_remaining_in_ms)),
+          context->CreateBoolean(deadline.did_timeout)};
+      context->CallFunction(function, 2, argv);
+    }
+    RemoveTask(weak_task.lock());
+  };
+
+  std::shared_ptr<JavaScriptTaskRunner> runner = scope->GetTaskRunner();
+  if (runner) {
+    runner->PostIdleTask(task, timeout);
+    runner_ = runner;
+  }
+  std::pair<TaskId, std::shared_ptr<TaskEntry>> item{task->id_, std::move(entry)};
+  task_map_.insert(item);
+
+  info.GetReturnValue()->SetLocal(context->CreateNumberLocal(task->id_));
+}
+
+void TimerModule::CancelIdleCallback(const napi::CallbackInfo& info) {
+  ClearInterval(info);
 }
 
-std::shared_ptr<hippy::napi::CtxValue> TimerModule::Start(
+hippy::napi::CtxLocalValue TimerModule::Start(
     const napi::CallbackInfo& info,
     bool repeat) {
   std::shared_ptr<Scope> scope = info.GetScope();
   std::shared_ptr<Ctx> context = scope->GetContext();
   TDF_BASE_CHECK(context);
 
-  std::shared_ptr<CtxValue> function = info[0];
+  CtxLocalValue function = info.GetLocalValue(0);
   if (!context->IsFunction(function)) {
     info.GetExceptionValue()->Set(context,
                                   "The first argument must be function.");
-    return nullptr;
+    return CtxLocalValue();
   }
 
   double number = 0;
-  context->GetValueNumber(info[1], &number);
+  context->GetValueNumber(info.GetLocalValue(1), &number);
 
   hippy::base::TaskRunner::DelayedTimeInMs interval =
       static_cast<hippy::base::TaskRunner::DelayedTimeInMs>(
           std::max(.0, number));
 
   std::shared_ptr<JavaScriptTask> task = std::make_shared<JavaScriptTask>();
+  task->source_ = repeat ? "SetInterval" : "SetTimeout";
   std::weak_ptr<JavaScriptTask> weak_task = task;
   std::weak_ptr<Scope> weak_scope = scope;
-  std::shared_ptr<TaskEntry> entry = std::make_shared<TaskEntry>(function, task);
+  std::shared_ptr<TaskEntry> entry =
+      std::make_shared<TaskEntry>(context->GlobalizeLocal(function), task);
   std::weak_ptr<CtxValue> weak_function = entry->func;
 
   task->callback = [this, weak_scope, weak_function, weak_task, repeat,
@@ -140,14 +217,15 @@ std::shared_ptr<hippy::napi::CtxValue> TimerModule::Start(
   std::shared_ptr<JavaScriptTaskRunner> runner = scope->GetTaskRunner();
   if (runner) {
     runner->PostDelayedTask(task, interval);
+    runner_ = runner;
   }
   std::pair<TaskId, std::shared_ptr<TaskEntry>> item{task->id_, std::move(entry)};
   task_map_.insert(item);
 
-  return context->CreateNumber(task->id_);
+  return context->CreateNumberLocal(task->id_);
 }
 
-void TimerModule::RemoveTask(const std::shared_ptr<JavaScriptTask>& task) {
+void TimerModule::RemoveTask(const std::shared_ptr<hippy::base::Task>& task) {
   if (!task) {
     return;
   }
@@ -159,7 +237,7 @@ void TimerModule::Cancel(TaskId task_id, const std::shared_ptr<Scope>& scope) {
   auto item = task_map_.find(task_id);
   if (item != task_map_.end()) {
     std::shared_ptr<JavaScriptTaskRunner> runner = scope->GetTaskRunner();
-    std::shared_ptr<JavaScriptTask> task = item->second->task.lock();
+    std::shared_ptr<hippy::base::Task> task = item->second->task.lock();
     if (runner) {
       runner->CancelTask(task);
     }
@@ -27,22 +27,51 @@
 namespace hippy {
 namespace napi {
 
-CallbackInfo::CallbackInfo(std::shared_ptr<Scope> scope) : scope_(std::move(scope)) {
-  ret_value_ = std::make_unique<ReturnValue>();
-  exception_value_ = std::make_unique<ExceptionValue>();
-}
+CallbackInfo::CallbackInfo(std::shared_ptr<Scope> scope) : scope_(std::move(scope)) {}
 
 void CallbackInfo::AddValue(const std::shared_ptr<CtxValue>& value) {
   if (!value)
     return;
+  TDF_BASE_DCHECK(values_.size() == length_) << "AddValue after AddLocalValue";
   values_.push_back(value);
+  ++length_;
+}
+
+void CallbackInfo::AddLocalValue(CtxLocalValue value) {
+  if (value.IsEmpty())
+    return;
+  TDF_BASE_DCHECK(values_.empty()) << "AddLocalValue after AddValue";
+  if (length_ < kInlineLocalValueCount) {
+    inline_local_values_[length_] = value;
+  } else {
+    local_values_.push_back(value);
+  }
+  ++length_;
 }
 
 std::shared_ptr<CtxValue> CallbackInfo::operator[](size_t index) const {
   if (index < 0 || static_cast<size_t>(index) >= Length()) {
     return nullptr;
   }
-  return values_[index];
+  if (values_.size() < length_) {
+    values_.resize(length_);
+  }
+  std::shared_ptr<CtxValue>& value = values_[index];
+  if (!value) {
+    value = scope_->GetContext()->GlobalizeLocal(GetLocalValue(index));
+  }
+  return value;
+}
+
+CtxLocalValue CallbackInfo::GetLocalValue(size_t index) const {
+  if (index >= Length()) {
+    return CtxLocalValue();
+  }
+  if (index < kInlineLocalValueCount) {
+    return inline_local_values_[index];
+  }
+  index -= kInlineLocalValueCount;
+  return index < local_values_.size() ? local_values_[index] : CtxLocalValue();
 }
 
 void ExceptionValue::Set(const std::shared_ptr<Ctx>& context,
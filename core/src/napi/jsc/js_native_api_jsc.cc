@@ -58,12 +58,9 @@ JSValueRef JsCallbackFunc(JSContextRef ctx,
     return JSValueMakeUndefined(ctx);
   }
   JsCallback cb = fn_data->callback_;
-  std::shared_ptr<JSCCtx> context =
-      std::static_pointer_cast<JSCCtx>(scope->GetContext());
   CallbackInfo info{scope};
   for (size_t i = 0; i < argumentCount; i++) {
-    info.AddValue(
-        std::make_shared<JSCCtxValue>(context->GetCtxRef(), arguments[i]));
+    info.AddLocalValue(ToCtxLocalValue(arguments[i]));
   }
   cb(info);
 
@@ -74,6 +71,11 @@ JSValueRef JsCallbackFunc(JSContextRef ctx,
     return JSValueMakeUndefined(ctx);
   }
 
+  CtxLocalValue ret_local_value = info.GetReturnValue()->GetLocal();
+  if (!ret_local_value.IsEmpty()) {
+    return ToJSValueRef(ret_local_value);
+  }
+
   std::shared_ptr<JSCCtxValue> ret_value =
       std::static_pointer_cast<JSCCtxValue>(info.GetReturnValue()->Get());
   if (!ret_value) {
@@ -122,7 +124,8 @@ JSObjectRef RegisterModule(std::shared_ptr<Scope> scope,
   return module_obj;
 }
 
-std::shared_ptr<VM> CreateVM(const std::shared_ptr<VMInitParam>& param) {
+std::shared_ptr<VM> CreateVM(const std::shared_ptr<VMInitParam>& param,
+                             bool is_thread_shared) {
   return std::make_shared<JSCVM>();
 }
 
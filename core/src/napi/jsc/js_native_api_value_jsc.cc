@@ -252,6 +252,119 @@ std::shared_ptr<CtxValue> JSCCtx::CreateNull() {
   return std::make_shared<JSCCtxValue>(context_, value);
 }
 
+CtxLocalValue JSCCtx::CreateNumberLocal(double number) {
+  return ToCtxLocalValue(JSValueMakeNumber(context_, number));
+}
+
+CtxLocalValue JSCCtx::CreateBooleanLocal(bool b) {
+  return ToCtxLocalValue(JSValueMakeBoolean(context_, b));
+}
+
+CtxLocalValue JSCCtx::CreateStringLocal(const unicode_string_view& str_view) {
+  JSStringRef str_ref = CreateJSCString(str_view);
+  JSValueRef value = JSValueMakeString(context_, str_ref);
+  JSStringRelease(str_ref);
+  return ToCtxLocalValue(value);
+}
+
+bool JSCCtx::GetValueNumber(CtxLocalValue value, double* result) {
+  if (value.IsEmpty()) {
+    return false;
+  }
+  JSValueRef value_ref = ToJSValueRef(value);
+  if (!JSValueIsNumber(context_, value_ref)) {
+    return false;
+  }
+  JSValueRef exception = nullptr;
+  *result = JSValueToNumber(context_, value_ref, &exception);
+  if (exception) {
+    SetException(std::make_shared<JSCCtxValue>(context_, exception));
+    return false;
+  }
+  return true;
+}
+
+bool JSCCtx::GetValueNumber(CtxLocalValue value, int32_t* result) {
+  if (value.IsEmpty()) {
+    return false;
+  }
+  JSValueRef value_ref = ToJSValueRef(value);
+  if (!JSValueIsNumber(context_, value_ref)) {
+    return false;
+  }
+  JSValueRef exception = nullptr;
+  *result = JSValueToNumber(context_, value_ref, &exception);
+  if (exception) {
+    SetException(std::make_shared<JSCCtxValue>(context_, exception));
+    return false;
+  }
+  return true;
+}
+
+bool JSCCtx::GetValueBoolean(CtxLocalValue value, bool* result) {
+  if (value.IsEmpty()) {
+    return false;
+  }
+  JSValueRef value_ref = ToJSValueRef(value);
+  if (!JSValueIsBoolean(context_, value_ref)) {
+    return false;
+  }
+  *result = JSValueToBoolean(context_, value_ref);
+  return true;
+}
+
+bool JSCCtx::GetValueString(CtxLocalValue value, unicode_string_view* result) {
+  if (value.IsEmpty()) {
+    return false;
+  }
+  JSValueRef value_ref = ToJSValueRef(value);
+  if (!JSValueIsString(context_, value_ref)) {
+    return false;
+  }
+  JSValueRef exception = nullptr;
+  JSStringRef str_ref = JSValueToStringCopy(context_, value_ref, &exception);
+  if (exception) {
+    SetException(std::make_shared<JSCCtxValue>(context_, exception));
+    return false;
+  }
+  *result = ToStrView(str_ref);
+  JSStringRelease(str_ref);
+  return true;
+}
+
+bool JSCCtx::IsNullOrUndefined(CtxLocalValue value) {
+  if (value.IsEmpty()) {
+    return true;
+  }
+  JSValueRef value_ref = ToJSValueRef(value);
+  return JSValueIsNull(context_, value_ref) ||
+         JSValueIsUndefined(context_, value_ref);
+}
+
+bool JSCCtx::IsFunction(CtxLocalValue value) {
+  if (value.IsEmpty()) {
+    return false;
+  }
+  JSValueRef value_ref = ToJSValueRef(value);
+  if (!JSValueIsObject(context_, value_ref)) {
+    return false;
+  }
+  JSValueRef exception = nullptr;
+  JSObjectRef object = JSValueToObject(context_, value_ref, &exception);
+  if (exception) {
+    SetException(std::make_shared<JSCCtxValue>(context_, exception));
+    return false;
+  }
+  return JSObjectIsFunction(context_, object);
+}
+
+std::shared_ptr<CtxValue> JSCCtx::GlobalizeLocal(CtxLocalValue value) {
+  if (value.IsEmpty()) {
+    return nullptr;
+  }
+  return std::make_shared<JSCCtxValue>(context_, ToJSValueRef(value));
+}
+
 std::shared_ptr<CtxValue> JSCCtx::ParseJson(const unicode_string_view& json) {
   JSStringRef str_ref = CreateJSCString(json);
   JSValueRef value = JSValueMakeFromJSONString(context_, str_ref);
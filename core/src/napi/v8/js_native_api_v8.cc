@@ -25,6 +25,8 @@
 #include <iostream>
 #include <sstream>
 
+#include "core/base/base_time.h"
+#include "core/base/startup_timeline.h"
 #include "core/base/string_view_utils.h"
 
 #include "v8/libplatform/libplatform.h"
@@ -39,28 +41,9 @@ using JSValueWrapper = hippy::base::JSValueWrapper;
 std::unique_ptr<v8::Platform> V8VM::platform_ = nullptr;
 std::mutex V8VM::mutex_;
 
-void JsCallbackFunc(const v8::FunctionCallbackInfo<v8::Value>& info) {
-  TDF_BASE_DLOG(INFO) << "JsCallbackFunc begin";
-
-  auto data = info.Data().As<v8::External>();
-  if (data.IsEmpty()) {
-    info.GetReturnValue().SetUndefined();
-    return;
-  }
-
-  auto* fn_data = reinterpret_cast<FunctionData*>(data->Value());
-  if (!fn_data) {
-    info.GetReturnValue().SetUndefined();
-    return;
-  }
-
-  JsCallback callback = fn_data->callback_;
-  std::shared_ptr<Scope> scope = fn_data->scope_.lock();
-  if (!scope) {
-    TDF_BASE_LOG(FATAL) << "JsCallbackFunc scope error";
-    info.GetReturnValue().SetUndefined();
-    return;
-  }
+static void InvokeJsCallback(const JsCallback& callback,
+                             const std::shared_ptr<Scope>& scope,
+                             const v8::FunctionCallbackInfo<v8::Value>& info) {
   CallbackInfo callback_info(scope);
 
   v8::Isolate* isolate = info.GetIsolate();
@@ -79,7 +62,7 @@ void JsCallbackFunc(const v8::FunctionCallbackInfo<v8::Value>& info) {
   v8::Context::Scope context_scope(context);
   TDF_BASE_DLOG(INFO) << "callback_info info.length = " << info.Length();
   for (int i = 0; i < info.Length(); i++) {
-    callback_info.AddValue(std::make_shared<V8CtxValue>(isolate, info[i]));
+    callback_info.AddLocalValue(ToCtxLocalValue(info[i]));
   }
   callback(callback_info);
 
@@ -95,6 +78,12 @@ void JsCallbackFunc(const v8::FunctionCallbackInfo<v8::Value>& info) {
     return;
   }
 
+  CtxLocalValue ret_local_value = callback_info.GetReturnValue()->GetLocal();
+  if (!ret_local_value.IsEmpty()) {
+    info.GetReturnValue().Set(ToV8LocalValue(ret_local_value));
+    return;
+  }
+
   std::shared_ptr<V8CtxValue> ret_value = std::static_pointer_cast<V8CtxValue>(
       callback_info.GetReturnValue()->Get());
   if (!ret_value) {
@@ -105,6 +94,65 @@ void JsCallbackFunc(const v8::FunctionCallbackInfo<v8::Value>& info) {
   info.GetReturnValue().Set(ret_value->global_value_);
 }
 
+void JsCallbackFunc(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  TDF_BASE_DLOG(INFO) << "JsCallbackFunc begin";
+
+  auto data = info.Data().As<v8::External>();
+  if (data.IsEmpty()) {
+    info.GetReturnValue().SetUndefined();
+    return;
+  }
+
+  auto* fn_data = reinterpret_cast<FunctionData*>(data->Value());
+  if (!fn_data) {
+    info.GetReturnValue().SetUndefined();
+    return;
+  }
+
+  JsCallback callback = fn_data->callback_;
+  std::shared_ptr<Scope> scope = fn_data->scope_.lock();
+  if (!scope) {
+    TDF_BASE_LOG(FATAL) << "JsCallbackFunc scope error";
+    info.GetReturnValue().SetUndefined();
+    return;
+  }
+  InvokeJsCallback(callback, scope, info);
+}
+
+static BindingTemplates* GetBindingTemplates(v8::Isolate* isolate) {
+  return reinterpret_cast<BindingTemplates*>(
+      isolate->GetData(V8VM::kBindingTemplatesSlotIndex));
+}
+
+static BindingData* GetBindingData(v8::Local<v8::Context> context) {
+  if (context.IsEmpty() ||
+      context->GetNumberOfEmbedderDataFields() <= V8VM::kBindingDataIndex) {
+    return nullptr;
+  }
+  return reinterpret_cast<BindingData*>(
+      context->GetAlignedPointerFromEmbedderData(V8VM::kBindingDataIndex));
+}
+
+void BindingCallbackFunc(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  TDF_BASE_DLOG(INFO) << "BindingCallbackFunc begin";
+
+  auto data = info.Data().As<v8::External>();
+  if (data.IsEmpty()) {
+    info.GetReturnValue().SetUndefined();
+    return;
+  }
+
+  auto* callback = reinterpret_cast<JsCallback*>(data->Value());
+  BindingData* binding_data = GetBindingData(info.GetIsolate()->GetCurrentContext());
+  std::shared_ptr<Scope> scope = binding_data ? binding_data->scope_.lock() : nullptr;
+  if (!callback || !scope) {
+    TDF_BASE_LOG(ERROR) << "BindingCallbackFunc scope error";
+    info.GetReturnValue().SetUndefined();
+    return;
+  }
+  InvokeJsCallback(*callback, scope, info);
+}
+
 void NativeCallbackFunc(const v8::FunctionCallbackInfo<v8::Value>& info) {
   TDF_BASE_DLOG(INFO) << "NativeCallbackFunc";
   auto data = info.Data().As<v8::External>();
@@ -121,14 +169,101 @@ void NativeCallbackFunc(const v8::FunctionCallbackInfo<v8::Value>& info) {
   TDF_BASE_DLOG(INFO) << "run native cb end";
 }
 
-void GetInternalBinding(const v8::FunctionCallbackInfo<v8::Value>& info) {
-  TDF_BASE_DLOG(INFO) << "v8 GetInternalBinding begin";
+static v8::Local<v8::String> NewV8String(v8::Isolate* isolate,
+                                         const unicode_string_view& str_view,
+                                         v8::NewStringType type) {
+  unicode_string_view::Encoding encoding = str_view.encoding();
+  switch (encoding) {
+    case unicode_string_view::Encoding::Latin1: {
+      const std::string& one_byte_str = str_view.latin1_value();
+      return v8::String::NewFromOneByte(
+                 isolate,
+                 reinterpret_cast<const uint8_t*>(one_byte_str.c_str()),
+                 type)
+          .ToLocalChecked();
+    }
+    case unicode_string_view::Encoding::Utf8: {
+      const unicode_string_view::u8string& utf8_str = str_view.utf8_value();
+      return v8::String::NewFromUtf8(
+                 isolate, reinterpret_cast<const char*>(utf8_str.c_str()),
+                 type)
+          .ToLocalChecked();
+    }
+    case unicode_string_view::Encoding::Utf16: {
+      const std::u16string& two_byte_str = str_view.utf16_value();
+      return v8::String::NewFromTwoByte(
+                 isolate,
+                 reinterpret_cast<const uint16_t*>(two_byte_str.c_str()),
+                 type)
+          .ToLocalChecked();
+    }
+    default:
+      break;
+  }
+  TDF_BASE_UNREACHABLE();
+}
 
-  auto data = info.Data().As<v8::External>();
-  if (data.IsEmpty()) {
-    info.GetReturnValue().SetUndefined();
-    return;
+void V8NameCache::RegisterNames(const std::vector<unicode_string_view>& names) {
+  v8::HandleScope handle_scope(isolate_);
+  for (const auto& name : names) {
+    Get(name);
+  }
+}
+
+v8::Local<v8::String> V8NameCache::Get(const unicode_string_view& name) {
+  auto it = names_.find(name);
+  if (it != names_.end()) {
+    return it->second.Get(isolate_);
+  }
+  v8::Local<v8::String> v8_name =
+      NewV8String(isolate_, name, v8::NewStringType::kInternalized);
+  if (names_.size() < kMaxSize) {
+    names_[name].Set(isolate_, v8_name);
+  } else {
+    TDF_BASE_DLOG(WARNING) << "V8NameCache full, name = " << name;
   }
+  return v8_name;
+}
+
+// Isolates of V8VM::CreateSnapshot have no name cache.
+static v8::Local<v8::String> GetV8Name(v8::Isolate* isolate,
+                                       const unicode_string_view& name) {
+  auto* name_cache = reinterpret_cast<V8NameCache*>(
+      isolate->GetData(V8VM::kNameCacheSlotIndex));
+  if (!name_cache) {
+    return NewV8String(isolate, name, v8::NewStringType::kInternalized);
+  }
+  return name_cache->Get(name);
+}
+
+// Builds the constructor template of a module once per isolate, whose
+// function templates share the isolate's copy of the module callbacks.
+static v8::Local<v8::FunctionTemplate> GetModuleTemplate(
+    v8::Isolate* isolate,
+    BindingTemplates* templates,
+    const unicode_string_view& module_name,
+    const ModuleClass& functions) {
+  auto it = templates->modules.find(module_name);
+  if (it != templates->modules.end()) {
+    return it->second.Get(isolate);
+  }
+  v8::Local<v8::FunctionTemplate> constructor = v8::FunctionTemplate::New(isolate);
+  for (const auto& fn : functions) {
+    const unicode_string_view& fn_name = fn.first;
+    templates->callbacks.push_back(std::make_unique<JsCallback>(fn.second));
+    v8::Local<v8::FunctionTemplate> function_template = v8::FunctionTemplate::New(
+        isolate, BindingCallbackFunc,
+        v8::External::New(isolate, static_cast<void*>(templates->callbacks.back().get())));
+    TDF_BASE_DLOG(INFO) << "bind fn_name = " << fn_name;
+    constructor->Set(GetV8Name(isolate, fn_name), function_template,
+                     v8::PropertyAttribute::ReadOnly);
+  }
+  templates->modules[module_name].Reset(isolate, constructor);
+  return constructor;
+}
+
+void GetInternalBinding(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  TDF_BASE_DLOG(INFO) << "v8 GetInternalBinding begin";
 
   auto count = info.Length();
   if (count <= 0 || !info[0]->IsString()) {
@@ -136,8 +271,12 @@ void GetInternalBinding(const v8::FunctionCallbackInfo<v8::Value>& info) {
     return;
   }
 
-  auto* binding_data = reinterpret_cast<BindingData*>(data->Value());
-  if (!binding_data) {
+  v8::Isolate* isolate = info.GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  BindingData* binding_data = GetBindingData(context);
+  BindingTemplates* templates = GetBindingTemplates(isolate);
+  if (!binding_data || !templates) {
     info.GetReturnValue().SetUndefined();
     return;
   }
@@ -151,12 +290,6 @@ void GetInternalBinding(const v8::FunctionCallbackInfo<v8::Value>& info) {
 
   std::shared_ptr<V8Ctx> v8_ctx =
       std::static_pointer_cast<V8Ctx>(scope->GetContext());
-
-  v8::Isolate* isolate = info.GetIsolate();
-  v8::HandleScope handle_scope(isolate);
-
-  v8::Local<v8::Context> context =
-      v8_ctx->context_persistent_.Get(v8_ctx->isolate_);
   v8::Context::Scope context_scope(context);
 
   v8::MaybeLocal<v8::String> maybe_module_name = info[0]->ToString(context);
@@ -190,21 +323,7 @@ void GetInternalBinding(const v8::FunctionCallbackInfo<v8::Value>& info) {
   }
 
   v8::Local<v8::FunctionTemplate> constructor =
-      v8::FunctionTemplate::New(isolate);
-  for (const auto& fn : module_class->second) {
-    const unicode_string_view& fn_name = fn.first;
-    std::unique_ptr<FunctionData> fn_data =
-        std::make_unique<FunctionData>(scope, fn.second);
-    v8::Local<v8::FunctionTemplate> function_template =
-        v8::FunctionTemplate::New(
-            isolate, JsCallbackFunc,
-            v8::External::New(isolate, static_cast<void*>(fn_data.get())));
-    scope->SaveFunctionData(std::move(fn_data));
-    TDF_BASE_DLOG(INFO) << "bind fn_name = " << fn_name;
-    v8::Local<v8::String> name = v8_ctx->CreateV8String(fn_name);
-    constructor->Set(name, function_template, v8::PropertyAttribute::ReadOnly);
-  }
-
+      GetModuleTemplate(isolate, templates, module_name, module_class->second);
   v8::Local<v8::Function> function =
       constructor->GetFunction(context).ToLocalChecked();
   scope->AddModuleValue(module_name,
@@ -214,8 +333,16 @@ void GetInternalBinding(const v8::FunctionCallbackInfo<v8::Value>& info) {
   TDF_BASE_DLOG(INFO) << "v8 GetInternalBinding end";
 }
 
-std::shared_ptr<VM> CreateVM(const std::shared_ptr<VMInitParam>& param) {
-  return std::make_shared<V8VM>(std::static_pointer_cast<V8VMInitParam>(param));
+void BindingTemplates::Reset() {
+  internal_binding.Reset();
+  for (auto& it : modules) {
+    it.second.Reset();
+  }
+  modules.clear();
+}
+
+std::shared_ptr<VM> CreateVM(const std::shared_ptr<VMInitParam>& param, bool is_thread_shared) {
+  return std::make_shared<V8VM>(std::static_pointer_cast<V8VMInitParam>(param), is_thread_shared);
 }
 
 std::shared_ptr<TryCatch> CreateTryCatchScope(bool enable,
@@ -223,38 +350,136 @@ std::shared_ptr<TryCatch> CreateTryCatchScope(bool enable,
   return std::make_shared<V8TryCatch>(enable, ctx);
 }
 
-V8VM::V8VM(const std::shared_ptr<V8VMInitParam>& param): VM(param) {
-  TDF_BASE_DLOG(INFO) << "V8VM begin";
-  {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (platform_ != nullptr) {
+void V8VM::InitializePlatform() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (platform_ != nullptr) {
 #if defined(V8_X5_LITE) && defined(THREAD_LOCAL_PLATFORM)
-      TDF_BASE_DLOG(INFO) << "InitializePlatform";
-      v8::V8::InitializePlatform(platform_.get());
+    TDF_BASE_DLOG(INFO) << "InitializePlatform";
+    v8::V8::InitializePlatform(platform_.get());
 #endif
-    } else {
-      TDF_BASE_DLOG(INFO) << "NewDefaultPlatform";
-      platform_ = v8::platform::NewDefaultPlatform();
+  } else {
+    hippy::base::StartupTimeline::ScopedPhase phase(
+        hippy::base::StartupTimeline::GetProcessTimeline(),
+        hippy::base::StartupTimeline::Phase::kPlatformInit);
+    TDF_BASE_DLOG(INFO) << "NewDefaultPlatform";
+    platform_ = v8::platform::NewDefaultPlatform();
 
 #if defined(V8_X5_LITE)
-      v8::V8::InitializePlatform(platform_.get(), true);
+    v8::V8::InitializePlatform(platform_.get(), true);
+#else
+    v8::V8::InitializePlatform(platform_.get());
+#endif
+    TDF_BASE_DLOG(INFO) << "Initialize";
+    v8::V8::Initialize();
+  }
+}
+
+const intptr_t* V8VM::GetExternalReferences() {
+  static const intptr_t external_references[] = {
+      reinterpret_cast<intptr_t>(JsCallbackFunc),
+      reinterpret_cast<intptr_t>(BindingCallbackFunc),
+      reinterpret_cast<intptr_t>(NativeCallbackFunc),
+      reinterpret_cast<intptr_t>(GetInternalBinding),
+      0};
+  return external_references;
+}
+
+std::string V8VM::CreateSnapshot() {
+  TDF_BASE_DLOG(INFO) << "CreateSnapshot begin";
+  InitializePlatform();
+
+  v8::SnapshotCreator creator(GetExternalReferences());
+  v8::Isolate* isolate = creator.GetIsolate();
+  bool is_complete = true;
+  {
+    v8::HandleScope handle_scope(isolate);
+    creator.SetDefaultContext(v8::Context::New(isolate));
+
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    // Not reachable from JS, contexts fetch it once when deserialized.
+    v8::Local<v8::Object> functions = v8::Object::New(isolate);
+    for (const auto& name : hippy::GetNativeSourceCodeNames()) {
+      auto source_code = hippy::GetNativeSourceCode(name);
+      v8::Local<v8::String> v8_name =
+          v8::String::NewFromUtf8(isolate, name.c_str(), v8::NewStringType::kInternalized)
+              .ToLocalChecked();
+      v8::Local<v8::String> source;
+      if (!v8::String::NewFromUtf8(isolate, reinterpret_cast<const char*>(source_code.data_),
+                                   v8::NewStringType::kNormal,
+                                   hippy::base::checked_numeric_cast<size_t, int>(
+                                       source_code.length_))
+               .ToLocal(&source)) {
+        is_complete = false;
+        break;
+      }
+#if (V8_MAJOR_VERSION == 8 && V8_MINOR_VERSION == 9 && \
+     V8_BUILD_NUMBER >= 45) ||                         \
+    (V8_MAJOR_VERSION == 8 && V8_MINOR_VERSION > 9) || (V8_MAJOR_VERSION > 8)
+      v8::ScriptOrigin origin(isolate, v8_name);
 #else
-      v8::V8::InitializePlatform(platform_.get());
+      v8::ScriptOrigin origin(v8_name);
 #endif
-      TDF_BASE_DLOG(INFO) << "Initialize";
-      v8::V8::Initialize();
+      v8::ScriptCompiler::Source script_source(source, origin);
+      v8::Local<v8::Script> script;
+      v8::Local<v8::Value> function;
+      // Eager compilation puts the bytecode of every function in the snapshot.
+      if (!v8::ScriptCompiler::Compile(context, &script_source,
+                                       v8::ScriptCompiler::kEagerCompile).ToLocal(&script) ||
+          !script->Run(context).ToLocal(&function) || !function->IsFunction() ||
+          functions->Set(context, v8_name, function).IsNothing()) {
+        TDF_BASE_LOG(ERROR) << "CreateSnapshot compile error, name = " << name;
+        is_complete = false;
+        break;
+      }
     }
+    size_t data_index = creator.AddData(context, functions);
+    TDF_BASE_DCHECK(data_index == kNativeSourceFunctionsIndex);
+    size_t context_index = creator.AddContext(context);
+    TDF_BASE_DCHECK(context_index == kSnapshotContextIndex);
   }
 
+  v8::StartupData data = creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kKeep);
+  std::string blob;
+  if (is_complete && data.data && data.raw_size > 0) {
+    blob.assign(data.data, static_cast<size_t>(data.raw_size));
+  }
+  delete[] data.data;
+  TDF_BASE_DLOG(INFO) << "CreateSnapshot end, size = " << blob.size();
+  return blob;
+}
+
+V8VM::V8VM(const std::shared_ptr<V8VMInitParam>& param, bool is_thread_shared)
+    : VM(param), is_thread_shared_(is_thread_shared) {
+  TDF_BASE_DLOG(INFO) << "V8VM begin";
+  InitializePlatform();
+
   create_params_.array_buffer_allocator =
       v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+  create_params_.external_references = GetExternalReferences();
   if (param) {
     create_params_.constraints.ConfigureDefaultsFromHeapSize(param->initial_heap_size_in_bytes,
                                                              param->maximum_heap_size_in_bytes);
+    if (param->snapshot_blob && !param->snapshot_blob->empty()) {
+      snapshot_blob_ = param->snapshot_blob;
+      snapshot_data_.data = snapshot_blob_->data();
+      snapshot_data_.raw_size = hippy::base::checked_numeric_cast<size_t, int>(snapshot_blob_->size());
+      create_params_.snapshot_blob = &snapshot_data_;
+    }
   }
   isolate_ = v8::Isolate::New(create_params_);
+  if (is_thread_shared_) {
+    // Every use of an isolate must be locked once a Locker was used for it.
+    locker_ = std::make_unique<v8::Locker>(isolate_);
+  }
   isolate_->Enter();
+  is_entered_ = true;
   isolate_->SetCaptureStackTraceForUncaughtExceptions(true);
+  binding_templates_ = std::make_unique<BindingTemplates>();
+  isolate_->SetData(kBindingTemplatesSlotIndex, binding_templates_.get());
+  name_cache_ = std::make_unique<V8NameCache>(isolate_);
+  isolate_->SetData(kNameCacheSlotIndex, name_cache_.get());
+  name_cache_->RegisterNames({kHippyErrorHandlerName, "length", "message", "stack"});
   if (param && param->near_heap_limit_callback) {
     isolate_->AddNearHeapLimitCallback(param->near_heap_limit_callback, param->near_heap_limit_callback_data);
   }
@@ -262,12 +487,21 @@ V8VM::V8VM(const std::shared_ptr<V8VMInitParam>& param): VM(param) {
 }
 
 V8VM::~V8VM() {
-  isolate_->Exit();
+  if (is_thread_shared_) {
+    // Possibly destroyed outside of a slice.
+    EnterThread();
+  }
+  binding_templates_->Reset();
+  ExitThread();
   isolate_->Dispose();
 
   delete create_params_.array_buffer_allocator;
 }
 
+void V8VM::RegisterNames(const std::vector<unicode_string_view>& names) {
+  name_cache_->RegisterNames(names);
+}
+
 void V8VM::PlatformDestroy() {
   platform_ = nullptr;
 
@@ -281,9 +515,57 @@ void V8VM::PlatformDestroy() {
 #endif
 }
 
+void V8VM::EnterThread() {
+  if (is_entered_) {
+    return;
+  }
+  locker_ = std::make_unique<v8::Locker>(isolate_);
+  isolate_->Enter();
+  is_entered_ = true;
+}
+
+void V8VM::ExitThread() {
+  if (!is_entered_) {
+    return;
+  }
+  isolate_->Exit();
+  locker_ = nullptr;
+  is_entered_ = false;
+}
+
+std::string V8VM::GetCodeCacheTag() {
+  return std::string(v8::V8::GetVersion()) + "-" +
+         std::to_string(v8::ScriptCompiler::CachedDataVersionTag());
+}
+
+size_t V8VM::GetUsedHeapSize() {
+  v8::HeapStatistics heap_statistics;
+  isolate_->GetHeapStatistics(&heap_statistics);
+  return heap_statistics.used_heap_size();
+}
+
 std::shared_ptr<Ctx> V8VM::CreateContext() {
   TDF_BASE_DLOG(INFO) << "CreateContext";
-  return std::make_shared<V8Ctx>(isolate_);
+  return std::make_shared<V8Ctx>(isolate_, snapshot_blob_ != nullptr);
+}
+
+V8Ctx::V8Ctx(v8::Isolate* isolate, bool from_snapshot) : isolate_(isolate) {
+  v8::HandleScope handle_scope(isolate);
+
+  v8::Local<v8::Context> context;
+  if (from_snapshot &&
+      v8::Context::FromSnapshot(isolate, V8VM::kSnapshotContextIndex).ToLocal(&context)) {
+    v8::Local<v8::Object> functions;
+    if (context->GetDataFromSnapshotOnce<v8::Object>(V8VM::kNativeSourceFunctionsIndex)
+            .ToLocal(&functions)) {
+      native_source_functions_.Reset(isolate, functions);
+    }
+  } else {
+    v8::Local<v8::ObjectTemplate> global = v8::ObjectTemplate::New(isolate);
+    context = v8::Context::New(isolate, nullptr, global);
+    global_persistent_.Reset(isolate, global);
+  }
+  context_persistent_.Reset(isolate, context);
 }
 
 V8TryCatch::V8TryCatch(bool enable, const std::shared_ptr<Ctx>& ctx)
@@ -377,12 +659,22 @@ std::shared_ptr<CtxValue> GetInternalBindingFn(const std::shared_ptr<Scope>& sco
   v8::Local<v8::Context> v8_context = ctx->context_persistent_.Get(isolate);
   v8::Context::Scope context_scope(v8_context);
 
+  // Read back by GetInternalBinding and the module functions, which are
+  // shared by all contexts of the isolate.
+  v8_context->SetAlignedPointerInEmbedderData(
+      V8VM::kBindingDataIndex, static_cast<void*>(scope->GetBindingData().get()));
+  v8::Local<v8::FunctionTemplate> function_template;
+  BindingTemplates* templates = GetBindingTemplates(isolate);
+  if (templates && !templates->internal_binding.IsEmpty()) {
+    function_template = templates->internal_binding.Get(isolate);
+  } else {
+    function_template = v8::FunctionTemplate::New(isolate, GetInternalBinding);
+    if (templates) {
+      templates->internal_binding.Reset(isolate, function_template);
+    }
+  }
   v8::Local<v8::Function> v8_function =
-      v8::Function::New(
-          v8_context, GetInternalBinding,
-          v8::External::New(isolate,
-                            static_cast<void*>(scope->GetBindingData().get())))
-          .ToLocalChecked();
+      function_template->GetFunction(v8_context).ToLocalChecked();
 
   return std::make_shared<V8CtxValue>(isolate, v8_function);
 }
@@ -539,6 +831,51 @@ bool V8Ctx::RegisterGlobalInJs() {
       .FromMaybe(false);
 }
 
+void V8Ctx::SaveGlobalNames() {
+  v8::HandleScope handle_scope(isolate_);
+  v8::Local<v8::Context> context = context_persistent_.Get(isolate_);
+  v8::Context::Scope context_scope(context);
+  v8::Local<v8::Array> names;
+  if (!context->Global()->GetOwnPropertyNames(context).ToLocal(&names)) {
+    return;
+  }
+  saved_global_names_.clear();
+  for (uint32_t i = 0; i < names->Length(); ++i) {
+    v8::Local<v8::Value> name;
+    if (names->Get(context, i).ToLocal(&name) && name->IsString()) {
+      saved_global_names_.insert(
+          StringViewUtils::ToU8StdStr(ToStringView(v8::Local<v8::String>::Cast(name))));
+    }
+  }
+  has_saved_global_names_ = true;
+}
+
+void V8Ctx::DeleteGlobalsAddedSinceSave() {
+  v8::HandleScope handle_scope(isolate_);
+  v8::Local<v8::Context> context = context_persistent_.Get(isolate_);
+  v8::Context::Scope context_scope(context);
+  v8::Local<v8::Object> global = context->Global();
+  v8::Local<v8::Array> names;
+  if (!global->GetOwnPropertyNames(context).ToLocal(&names)) {
+    return;
+  }
+  for (uint32_t i = 0; i < names->Length(); ++i) {
+    v8::Local<v8::Value> name;
+    if (!names->Get(context, i).ToLocal(&name) || !name->IsString()) {
+      continue;
+    }
+    std::string name_str =
+        StringViewUtils::ToU8StdStr(ToStringView(v8::Local<v8::String>::Cast(name)));
+    if (saved_global_names_.find(name_str) != saved_global_names_.end()) {
+      continue;
+    }
+    TDF_BASE_DLOG(INFO) << "delete global " << name_str;
+    if (!global->Delete(context, name).FromMaybe(false)) {
+      global->Set(context, name, v8::Undefined(isolate_)).FromMaybe(false);
+    }
+  }
+}
+
 bool V8Ctx::SetGlobalJsonVar(const unicode_string_view& name,
                              const unicode_string_view& json) {
   TDF_BASE_DLOG(INFO) << "SetGlobalJsonVar name = " << name
@@ -553,7 +890,7 @@ bool V8Ctx::SetGlobalJsonVar(const unicode_string_view& name,
   v8::Local<v8::Object> global = context->Global();
 
   v8::Local<v8::String> v8_str = CreateV8String(json);
-  v8::Local<v8::String> v8_name = CreateV8String(name);
+  v8::Local<v8::String> v8_name = CreateV8Name(name);
   v8::MaybeLocal<v8::Value> json_obj = v8::JSON::Parse(context, v8_str);
   if (!json_obj.IsEmpty()) {
     return global->Set(context, v8_name, json_obj.ToLocalChecked())
@@ -573,7 +910,7 @@ bool V8Ctx::SetGlobalStrVar(const unicode_string_view& name,
   v8::Context::Scope context_scope(context);
   v8::Local<v8::Object> global = context->Global();
   v8::Local<v8::String> v8_str = CreateV8String(str);
-  v8::Local<v8::String> v8_name = CreateV8String(name);
+  v8::Local<v8::String> v8_name = CreateV8Name(name);
   return global->Set(context, v8_name, v8_str).FromMaybe(false);
 }
 
@@ -600,7 +937,7 @@ bool V8Ctx::SetGlobalObjVar(const unicode_string_view& name,
     handle_value = v8::Null(isolate_);
   }
   auto v8_attr = v8::PropertyAttribute(attr);
-  v8::Local<v8::String> v8_name = CreateV8String(name);
+  v8::Local<v8::String> v8_name = CreateV8Name(name);
   return global->DefineOwnProperty(context, v8_name, handle_value, v8_attr)
       .FromMaybe(false);
 }
@@ -615,7 +952,7 @@ std::shared_ptr<CtxValue> V8Ctx::GetGlobalStrVar(
   v8::Local<v8::Context> context = context_persistent_.Get(isolate_);
   v8::Context::Scope context_scope(context);
   v8::Local<v8::Object> global = context->Global();
-  v8::Local<v8::String> v8_name = CreateV8String(name);
+  v8::Local<v8::String> v8_name = CreateV8Name(name);
   v8::MaybeLocal<v8::Value> maybe_value = global->Get(context, v8_name);
   if (maybe_value.IsEmpty()) {
     return CreateUndefined();
@@ -639,7 +976,7 @@ std::shared_ptr<CtxValue> V8Ctx::GetProperty(
   v8::Local<v8::Context> context = context_persistent_.Get(isolate_);
   v8::Context::Scope context_scope(context);
   const v8::Global<v8::Value>& persistent_value = ctx_value->global_value_;
-  v8::Local<v8::Value> str = CreateV8String(name);
+  v8::Local<v8::Value> str = CreateV8Name(name);
   v8::Local<v8::Value> handle_value =
       v8::Local<v8::Value>::New(isolate_, persistent_value);
   v8::Local<v8::Value> value = v8::Local<v8::Object>::Cast(handle_value)
@@ -663,7 +1000,7 @@ void V8Ctx::RegisterGlobalModule(const std::shared_ptr<Scope>& scope,
       std::unique_ptr<FunctionData> data =
           std::make_unique<FunctionData>(scope, fn.second);
       module_object->Set(
-          CreateV8String(fn.first),
+          CreateV8Name(fn.first),
           v8::FunctionTemplate::New(
               isolate_, JsCallbackFunc,
               v8::External::New(isolate_, static_cast<void*>(data.get()))));
@@ -673,7 +1010,7 @@ void V8Ctx::RegisterGlobalModule(const std::shared_ptr<Scope>& scope,
     v8::Local<v8::Function> function =
         module_object->GetFunction(context).ToLocalChecked();
 
-    v8::Local<v8::String> classNameKey = CreateV8String(cls.first);
+    v8::Local<v8::String> classNameKey = CreateV8Name(cls.first);
     v8::Maybe<bool> ret =
         context->Global()->Set(context, classNameKey, function);
     ret.ToChecked();
@@ -693,7 +1030,7 @@ void V8Ctx::RegisterNativeBinding(const unicode_string_view& name,
       isolate_, NativeCallbackFunc,
       v8::External::New(isolate_, static_cast<void*>(data_tuple_.get())));
   fn_template->RemovePrototype();
-  v8::Local<v8::String> v8_name = CreateV8String(name);
+  v8::Local<v8::String> v8_name = CreateV8Name(name);
   context->Global()
       ->Set(context, v8_name,
             fn_template->GetFunction(context).ToLocalChecked())
@@ -716,6 +1053,18 @@ std::shared_ptr<CtxValue> V8Ctx::RunScript(const unicode_string_view& str_view,
   v8::HandleScope handle_scope(isolate_);
   v8::Local<v8::Context> context = context_persistent_.Get(isolate_);
   v8::Context::Scope context_scope(context);
+  v8::MaybeLocal<v8::String> source = CreateSourceString(str_view, is_copy);
+  if (source.IsEmpty()) {
+    TDF_BASE_DLOG(WARNING) << "v8_source empty, file_name = " << file_name;
+    return nullptr;
+  }
+
+  return InternalRunScript(context, source.ToLocalChecked(), file_name,
+                           is_use_code_cache, cache);
+}
+
+v8::MaybeLocal<v8::String> V8Ctx::CreateSourceString(const unicode_string_view& str_view,
+                                                     bool is_copy) const {
   v8::MaybeLocal<v8::String> source;
 
   unicode_string_view::Encoding encoding = str_view.encoding();
@@ -770,29 +1119,145 @@ std::shared_ptr<CtxValue> V8Ctx::RunScript(const unicode_string_view& str_view,
     }
   }
 
-  if (source.IsEmpty()) {
+  return source;
+}
+
+std::shared_ptr<CtxValue> V8Ctx::RunScriptWithCodeCache(const unicode_string_view& data,
+                                                        const unicode_string_view& file_name,
+                                                        const uint8_t* code_cache,
+                                                        size_t code_cache_length,
+                                                        CodeCacheRequest* code_cache_request) {
+  TDF_BASE_LOG(INFO) << "V8Ctx::RunScriptWithCodeCache file_name = " << file_name
+                     << ", code_cache_length = " << code_cache_length;
+  v8::HandleScope handle_scope(isolate_);
+  v8::Local<v8::Context> context = context_persistent_.Get(isolate_);
+  v8::Context::Scope context_scope(context);
+
+  v8::Local<v8::String> source;
+  if (!CreateSourceString(data, true).ToLocal(&source)) {
     TDF_BASE_DLOG(WARNING) << "v8_source empty, file_name = " << file_name;
     return nullptr;
   }
-
-  return InternalRunScript(context, source.ToLocalChecked(), file_name,
-                           is_use_code_cache, cache);
+  v8::Local<v8::Script> script;
+  bool is_rejected = true;
+  // Compares launches with and without (a deferred) code cache.
+  uint64_t compile_begin = hippy::base::MonotonicallyIncreasingTimeInUs();
+  if (code_cache && code_cache_length) {
+    // Owned by script_source, the buffer is not.
+    auto* cached_data = new v8::ScriptCompiler::CachedData(
+        code_cache, hippy::base::checked_numeric_cast<size_t, int>(code_cache_length),
+        v8::ScriptCompiler::CachedData::BufferNotOwned);
+    v8::ScriptCompiler::Source script_source(source, CreateScriptOrigin(file_name), cached_data);
+    if (!v8::ScriptCompiler::Compile(context, &script_source,
+                                     v8::ScriptCompiler::kConsumeCodeCache).ToLocal(&script)) {
+      return nullptr;
+    }
+    is_rejected = script_source.GetCachedData()->rejected;
+    TDF_BASE_DLOG(INFO) << "code cache rejected = " << is_rejected;
+  } else {
+    v8::ScriptCompiler::Source script_source(source, CreateScriptOrigin(file_name));
+    if (!v8::ScriptCompiler::Compile(context, &script_source).ToLocal(&script)) {
+      return nullptr;
+    }
+  }
+  uint64_t compile_end = hippy::base::MonotonicallyIncreasingTimeInUs();
+  TDF_BASE_LOG(INFO) << "V8Ctx::RunScriptWithCodeCache compile_time_in_us = "
+                     << compile_end - compile_begin << ", is_rejected = " << is_rejected;
+  if (startup_timeline_) {
+    startup_timeline_->Record(hippy::base::StartupTimeline::Phase::kCompile, compile_begin,
+                              compile_end);
+  }
+  if (is_rejected && code_cache_request) {
+    FulfillCodeCacheRequest(script, code_cache_request);
+  }
+  return RunCompiledScript(context, script);
 }
 
-std::shared_ptr<CtxValue> V8Ctx::InternalRunScript(
-    v8::Local<v8::Context> context,
-    v8::Local<v8::String> source,
+std::shared_ptr<CtxValue> V8Ctx::RunStreamedScript(
+    const std::shared_ptr<V8ScriptStreamer>& streamer,
     const unicode_string_view& file_name,
-    bool is_use_code_cache,
-    unicode_string_view* cache) {
+    CodeCacheRequest* code_cache_request) {
+  TDF_BASE_LOG(INFO) << "V8Ctx::RunStreamedScript file_name = " << file_name;
+  v8::HandleScope handle_scope(isolate_);
+  v8::Local<v8::Context> context = context_persistent_.Get(isolate_);
+  v8::Context::Scope context_scope(context);
+
+  v8::Local<v8::Script> script;
+  {
+    // Only what is left after the streamer compiled alongside the read.
+    hippy::base::StartupTimeline::ScopedPhase phase(
+        startup_timeline_.get(), hippy::base::StartupTimeline::Phase::kCompile);
+    if (!streamer->Compile(context, CreateScriptOrigin(file_name)).ToLocal(&script)) {
+      return nullptr;
+    }
+  }
+  if (code_cache_request) {
+    FulfillCodeCacheRequest(script, code_cache_request);
+  }
+  return RunCompiledScript(context, script);
+}
+
+std::string V8Ctx::CreateDeferredCodeCache(uint32_t deferred_script_id) {
+  auto it = deferred_scripts_.find(deferred_script_id);
+  if (it == deferred_scripts_.end()) {
+    return std::string();
+  }
+  v8::HandleScope handle_scope(isolate_);
+  v8::Local<v8::UnboundScript> unbound_script = it->second.Get(isolate_);
+  it->second.Reset();
+  deferred_scripts_.erase(it);
+  return CreateCodeCache(unbound_script);
+}
+
+std::string V8Ctx::CreateCodeCache(v8::Local<v8::UnboundScript> unbound_script) {
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data(
+      v8::ScriptCompiler::CreateCodeCache(unbound_script));
+  if (!cached_data) {
+    return std::string();
+  }
+  return std::string(reinterpret_cast<const char*>(cached_data->data),
+                     hippy::base::checked_numeric_cast<int, size_t>(cached_data->length));
+}
+
+void V8Ctx::FulfillCodeCacheRequest(v8::Local<v8::Script> script, CodeCacheRequest* request) {
+  request->is_needed = true;
+  if (request->timing == CodeCacheRequest::Timing::kAfterCompile) {
+    request->code_cache = CreateCodeCache(script->GetUnboundScript());
+    return;
+  }
+  request->deferred_script_id = next_deferred_script_id_++;
+  deferred_scripts_[request->deferred_script_id].Reset(isolate_, script->GetUnboundScript());
+}
+
+std::shared_ptr<CtxValue> V8Ctx::RunCompiledScript(v8::Local<v8::Context> context,
+                                                   v8::Local<v8::Script> script) {
+  v8::Local<v8::Value> v8_value;
+  hippy::base::StartupTimeline::ScopedPhase phase(
+      startup_timeline_.get(), hippy::base::StartupTimeline::Phase::kFirstScriptRun);
+  if (!script->Run(context).ToLocal(&v8_value)) {
+    return nullptr;
+  }
+  return std::make_shared<V8CtxValue>(isolate_, v8_value);
+}
+
+v8::ScriptOrigin V8Ctx::CreateScriptOrigin(const unicode_string_view& file_name) const {
   v8::Local<v8::String> v8_file_name = CreateV8String(file_name);
 #if (V8_MAJOR_VERSION == 8 && V8_MINOR_VERSION == 9 && \
      V8_BUILD_NUMBER >= 45) ||                         \
     (V8_MAJOR_VERSION == 8 && V8_MINOR_VERSION > 9) || (V8_MAJOR_VERSION > 8)
-  v8::ScriptOrigin origin(isolate_, v8_file_name);
+  return v8::ScriptOrigin(isolate_, v8_file_name);
 #else
-  v8::ScriptOrigin origin(v8_file_name);
+  return v8::ScriptOrigin(v8_file_name);
 #endif
+}
+
+std::shared_ptr<CtxValue> V8Ctx::InternalRunScript(
+    v8::Local<v8::Context> context,
+    v8::Local<v8::String> source,
+    const unicode_string_view& file_name,
+    bool is_use_code_cache,
+    unicode_string_view* cache) {
+  v8::ScriptOrigin origin = CreateScriptOrigin(file_name);
   v8::MaybeLocal<v8::Script> script;
   if (is_use_code_cache && cache && !StringViewUtils::IsEmpty(*cache)) {
     unicode_string_view::Encoding encoding = cache->encoding();
@@ -848,7 +1313,7 @@ std::shared_ptr<CtxValue> V8Ctx::GetJsFn(const unicode_string_view& name) {
   v8::Local<v8::Context> context = context_persistent_.Get(isolate_);
   v8::Context::Scope context_scope(context);
 
-  v8::Local<v8::String> js_name = CreateV8String(name);
+  v8::Local<v8::String> js_name = CreateV8Name(name);
   v8::MaybeLocal<v8::Value> maybe_func =
       context_persistent_.Get(isolate_)->Global()->Get(context, js_name);
   if (maybe_func.IsEmpty()) {
@@ -857,6 +1322,23 @@ std::shared_ptr<CtxValue> V8Ctx::GetJsFn(const unicode_string_view& name) {
   return std::make_shared<V8CtxValue>(isolate_, maybe_func.ToLocalChecked());
 }
 
+std::shared_ptr<CtxValue> V8Ctx::GetNativeSourceFunction(const unicode_string_view& name) {
+  if (native_source_functions_.IsEmpty()) {
+    return nullptr;
+  }
+  v8::HandleScope handle_scope(isolate_);
+  v8::Local<v8::Context> context = context_persistent_.Get(isolate_);
+  v8::Context::Scope context_scope(context);
+
+  v8::Local<v8::Object> functions = native_source_functions_.Get(isolate_);
+  v8::Local<v8::Value> function;
+  if (!functions->Get(context, CreateV8Name(name)).ToLocal(&function) ||
+      !function->IsFunction()) {
+    return nullptr;
+  }
+  return std::make_shared<V8CtxValue>(isolate_, function);
+}
+
 void V8Ctx::ThrowException(const std::shared_ptr<CtxValue> &exception) {
   std::shared_ptr<V8CtxValue> ctx_value = std::static_pointer_cast<V8CtxValue>(exception);
   v8::HandleScope handle_scope(isolate_);
@@ -1008,35 +1490,12 @@ std::shared_ptr<CtxValue> V8Ctx::CreateNull() {
 
 v8::Local<v8::String> V8Ctx::CreateV8String(
     const unicode_string_view& str_view) const {
-  unicode_string_view::Encoding encoding = str_view.encoding();
-  switch (encoding) {
-    case unicode_string_view::Encoding::Latin1: {
-      const std::string& one_byte_str = str_view.latin1_value();
-      return v8::String::NewFromOneByte(
-                 isolate_,
-                 reinterpret_cast<const uint8_t*>(one_byte_str.c_str()),
-                 v8::NewStringType::kNormal)
-          .ToLocalChecked();
-    }
-    case unicode_string_view::Encoding::Utf8: {
-      const unicode_string_view::u8string& utf8_str = str_view.utf8_value();
-      return v8::String::NewFromUtf8(
-                 isolate_, reinterpret_cast<const char*>(utf8_str.c_str()),
-                 v8::NewStringType::kNormal)
-          .ToLocalChecked();
-    }
-    case unicode_string_view::Encoding::Utf16: {
-      const std::u16string& two_byte_str = str_view.utf16_value();
-      return v8::String::NewFromTwoByte(
-                 isolate_,
-                 reinterpret_cast<const uint16_t*>(two_byte_str.c_str()),
-                 v8::NewStringType::kNormal)
-          .ToLocalChecked();
-    }
-    default:
-      break;
-  }
-  TDF_BASE_UNREACHABLE();
+  return NewV8String(isolate_, str_view, v8::NewStringType::kNormal);
+}
+
+v8::Local<v8::String> V8Ctx::CreateV8Name(
+    const unicode_string_view& name) const {
+  return GetV8Name(isolate_, name);
 }
 
 std::shared_ptr<JSValueWrapper> V8Ctx::ToJsValueWrapper(
@@ -1049,129 +1508,248 @@ std::shared_ptr<JSValueWrapper> V8Ctx::ToJsValueWrapper(
   const v8::Global<v8::Value>& global_value = ctx_value->global_value_;
   v8::Local<v8::Value> handle_value =
       v8::Local<v8::Value>::New(isolate_, global_value);
-  if (handle_value->IsUndefined()) {
-    return std::make_shared<JSValueWrapper>(JSValueWrapper::Undefined());
-  } else if (handle_value->IsNull()) {
-    return std::make_shared<JSValueWrapper>(JSValueWrapper::Null());
-  } else if (handle_value->IsBoolean()) {
-    bool v8_value = handle_value->ToBoolean(isolate_)->Value();
-    return std::make_shared<JSValueWrapper>(v8_value);
-  } else if (handle_value->IsString()) {
-    return std::make_shared<JSValueWrapper>(
-        *v8::String::Utf8Value(isolate_, handle_value));
-  } else if (handle_value->IsNumber()) {
-    double v8_value = handle_value->ToNumber(context).ToLocalChecked()->Value();
-    return std::make_shared<JSValueWrapper>(v8_value);
-  } else if (handle_value->IsArray()) {
-    v8::Local<v8::Object> v8_value =
-        handle_value->ToObject(context).ToLocalChecked();
-    // v8::NewStringType::kInternalized
-    v8::Local<v8::Array>::Cast(handle_value);
-    v8::Local<v8::String> len_str =
-        v8::String::NewFromOneByte(isolate_,
-                                   reinterpret_cast<const uint8_t*>("length"),
-                                   v8::NewStringType::kInternalized)
-            .ToLocalChecked();
-    uint32_t len = v8_value->Get(context, len_str)
-                       .ToLocalChecked()
-                       ->Uint32Value(context)
-                       .FromMaybe(0);
-    JSValueWrapper::JSArrayType ret;
-    for (uint32_t i = 0; i < len; i++) {
-      v8::Local<v8::Value> element = v8_value->Get(context, i).ToLocalChecked();
-      std::shared_ptr<JSValueWrapper> value_obj =
-          ToJsValueWrapper(std::make_shared<V8CtxValue>(isolate_, element));
-      ret.push_back(*value_obj);
+  auto result = std::make_shared<JSValueWrapper>();
+  if (!ConvertV8Value(context, handle_value, result.get())) {
+    return nullptr;
+  }
+  return result;
+}
+
+bool V8Ctx::ConvertV8Value(v8::Local<v8::Context> context,
+                           v8::Local<v8::Value> value,
+                           JSValueWrapper* result) {
+  if (value->IsUndefined()) {
+    *result = JSValueWrapper::Undefined();
+  } else if (value->IsNull()) {
+    *result = JSValueWrapper::Null();
+  } else if (value->IsBoolean()) {
+    *result = value.As<v8::Boolean>()->Value();
+  } else if (value->IsString()) {
+    v8::String::Utf8Value utf8_value(isolate_, value);
+    *result = JSValueWrapper(std::string(*utf8_value, utf8_value.length()));
+  } else if (value->IsNumber()) {
+    *result = value.As<v8::Number>()->Value();
+  } else if (value->IsArray()) {
+    v8::Local<v8::Array> array = value.As<v8::Array>();
+    uint32_t length = array->Length();
+    JSValueWrapper::JSArrayType ret(length);
+    for (uint32_t i = 0; i < length; i++) {
+      v8::Local<v8::Value> element;
+      if (!array->Get(context, i).ToLocal(&element) ||
+          !ConvertV8Value(context, element, &ret[i])) {
+        return false;
+      }
     }
-    return std::make_shared<JSValueWrapper>(std::move(ret));
-  } else if (handle_value->IsObject()) {
-    v8::Local<v8::Object> v8_value =
-        handle_value->ToObject(context).ToLocalChecked();
+    *result = JSValueWrapper(std::move(ret));
+  } else if (value->IsObject()) {
+    v8::Local<v8::Object> object = value.As<v8::Object>();
     JSValueWrapper::JSObjectType ret;
-    v8::MaybeLocal<v8::Array> maybe_props =
-        v8_value->GetOwnPropertyNames(context);
-    if (!maybe_props.IsEmpty()) {
-      v8::Local<v8::Array> props = maybe_props.ToLocalChecked();
-      for (uint32_t i = 0; i < props->Length(); i++) {
-        v8::Local<v8::Value> props_key =
-            props->Get(context, i).ToLocalChecked();
-        v8::Local<v8::Value> props_value =
-            v8_value->Get(context, props_key).ToLocalChecked();
-
-        std::string key_obj;
-        if (props_key->IsString()) {
-          key_obj = *v8::String::Utf8Value(isolate_, props_key);
-        } else {
+    v8::Local<v8::Array> props;
+    if (object->GetOwnPropertyNames(context).ToLocal(&props)) {
+      uint32_t length = props->Length();
+      ret.reserve(length);
+      for (uint32_t i = 0; i < length; i++) {
+        v8::Local<v8::Value> props_key;
+        v8::Local<v8::Value> props_value;
+        if (!props->Get(context, i).ToLocal(&props_key) ||
+            !object->Get(context, props_key).ToLocal(&props_value)) {
+          return false;
+        }
+        if (!props_key->IsString()) {
           TDF_BASE_LOG(ERROR)
               << "ToJsValueWrapper parse v8::Object err, props_key illegal";
-          return nullptr;
+          return false;
+        }
+        // Own property names are unique.
+        v8::String::Utf8Value key(isolate_, props_key);
+        JSValueWrapper& element = ret.emplace_back(
+            hippy::base::JSValueKey(*key, key.length()), JSValueWrapper()).second;
+        if (!ConvertV8Value(context, props_value, &element)) {
+          return false;
         }
-
-        std::shared_ptr<JSValueWrapper> value_obj = ToJsValueWrapper(
-            std::make_shared<V8CtxValue>(isolate_, props_value));
-        ret[key_obj] = *value_obj;
       }
     }
-    return std::make_shared<JSValueWrapper>(std::move(ret));
+    *result = JSValueWrapper(std::move(ret));
+  } else {
+    return false;
   }
-
-  // TDF_BASE_UNIMPLEMENTED();
-  return nullptr;
+  return true;
 }
 
 std::shared_ptr<CtxValue> V8Ctx::CreateCtxValue(
     const std::shared_ptr<JSValueWrapper>& wrapper) {
   TDF_BASE_DCHECK(wrapper);
-  if (wrapper->IsUndefined()) {
-    return CreateUndefined();
-  } else if (wrapper->IsNull()) {
-    return CreateNull();
-  } else if (wrapper->IsString()) {
-    std::string str = wrapper->StringValue();
-    unicode_string_view str_view(StringViewUtils::ToU8Pointer(str.c_str()),
-                                 str.length());
-    return CreateString(str_view);
-  } else if (wrapper->IsInt32()) {
-    return CreateNumber(wrapper->Int32Value());
-  } else if (wrapper->IsDouble()) {
-    return CreateNumber(wrapper->DoubleValue());
-  } else if (wrapper->IsBoolean()) {
-    return CreateBoolean(wrapper->BooleanValue());
-  } else if (wrapper->IsArray()) {
-    auto arr = wrapper->ArrayValue();
-    std::shared_ptr<CtxValue> args[arr.size()];
-    for (size_t i = 0; i < arr.size(); ++i) {
-      args[i] = CreateCtxValue(std::make_shared<JSValueWrapper>(arr[i]));
-    }
-    return CreateArray(arr.size(), args);
-  } else if (wrapper->IsObject()) {
-    auto obj = wrapper->ObjectValue();
-
-    v8::HandleScope handle_scope(isolate_);
-    v8::Local<v8::Context> context = context_persistent_.Get(isolate_);
-    v8::Context::Scope context_scope(context);
+  v8::HandleScope handle_scope(isolate_);
+  v8::Local<v8::Context> context = context_persistent_.Get(isolate_);
+  v8::Context::Scope context_scope(context);
+  v8::Local<v8::Value> value;
+  if (!CreateV8Value(context, *wrapper).ToLocal(&value)) {
+    return nullptr;
+  }
+  return std::make_shared<V8CtxValue>(isolate_, value);
+}
 
-    v8::Local<v8::Object> v8_obj = v8::Object::New(isolate_);
-    for (const auto& p : obj) {
-      auto obj_key = p.first;
-      auto obj_value = p.second;
-      unicode_string_view obj_key_view(
-          StringViewUtils::ToU8Pointer(obj_key.c_str()), obj_key.length());
-      v8::Local<v8::String> key = CreateV8String(obj_key_view);
-      std::shared_ptr<V8CtxValue> ctx_value =
-          std::static_pointer_cast<V8CtxValue>(
-              CreateCtxValue(std::make_shared<JSValueWrapper>(obj_value)));
-      const v8::Global<v8::Value>& global_value = ctx_value->global_value_;
-      TDF_BASE_DCHECK(!global_value.IsEmpty());
-      v8::Local<v8::Value> handle_value =
-          v8::Local<v8::Value>::New(isolate_, global_value);
-      v8_obj->Set(context, key, handle_value).ToChecked();
+v8::MaybeLocal<v8::Value> V8Ctx::CreateV8Value(v8::Local<v8::Context> context,
+                                               const JSValueWrapper& wrapper) {
+  if (wrapper.IsUndefined()) {
+    return v8::Undefined(isolate_);
+  } else if (wrapper.IsNull()) {
+    return v8::Null(isolate_);
+  } else if (wrapper.IsString()) {
+    const std::string& str = wrapper.StringValue();
+    int length;
+    if (!hippy::base::numeric_cast<size_t, int>(str.length(), length)) {
+      TDF_BASE_LOG(ERROR) << "string length out of boundary";
+      return v8::MaybeLocal<v8::Value>();
+    }
+    v8::Local<v8::String> v8_string;
+    if (!v8::String::NewFromUtf8(isolate_, str.c_str(),
+                                 v8::NewStringType::kNormal, length)
+             .ToLocal(&v8_string)) {
+      return v8::MaybeLocal<v8::Value>();
+    }
+    return v8_string;
+  } else if (wrapper.IsInt32()) {
+    return v8::Integer::New(isolate_, wrapper.Int32Value());
+  } else if (wrapper.IsUInt32()) {
+    return v8::Integer::NewFromUnsigned(isolate_, wrapper.UInt32Value());
+  } else if (wrapper.IsDouble()) {
+    return v8::Number::New(isolate_, wrapper.DoubleValue());
+  } else if (wrapper.IsBoolean()) {
+    return v8::Boolean::New(isolate_, wrapper.BooleanValue());
+  } else if (wrapper.IsArray()) {
+    const JSValueWrapper::JSArrayType& arr = wrapper.ArrayValue();
+    int array_size;
+    if (!hippy::base::numeric_cast<size_t, int>(arr.size(), array_size)) {
+      TDF_BASE_LOG(ERROR) << "array length out of boundary";
+      return v8::MaybeLocal<v8::Value>();
+    }
+    v8::Local<v8::Array> array = v8::Array::New(isolate_, array_size);
+    for (uint32_t i = 0; i < arr.size(); ++i) {
+      v8::Local<v8::Value> element;
+      if (!CreateV8Value(context, arr[i]).ToLocal(&element) ||
+          !array->Set(context, i, element).FromMaybe(false)) {
+        TDF_BASE_LOG(ERROR) << "array item error";
+        return v8::MaybeLocal<v8::Value>();
+      }
+    }
+    return array;
+  } else if (wrapper.IsObject()) {
+    v8::Local<v8::Object> object = v8::Object::New(isolate_);
+    for (const auto& p : wrapper.ObjectValue()) {
+      const hippy::base::JSValueKey& obj_key = p.first;
+      v8::Local<v8::String> key;
+      v8::Local<v8::Value> element;
+      if (!v8::String::NewFromUtf8(isolate_, obj_key.data(),
+                                   v8::NewStringType::kInternalized,
+                                   static_cast<int>(obj_key.length()))
+               .ToLocal(&key) ||
+          !CreateV8Value(context, p.second).ToLocal(&element) ||
+          !object->Set(context, key, element).FromMaybe(false)) {
+        TDF_BASE_LOG(ERROR) << "object item error";
+        return v8::MaybeLocal<v8::Value>();
+      }
     }
-    return std::make_shared<V8CtxValue>(isolate_, v8_obj);
+    return object;
   }
 
   TDF_BASE_UNIMPLEMENTED();
-  return nullptr;
+  return v8::MaybeLocal<v8::Value>();
+}
+
+// The local value helpers run inside a native callback, in its handle scope
+// and context.
+
+CtxLocalValue V8Ctx::CreateNumberLocal(double number) {
+  return ToCtxLocalValue(v8::Number::New(isolate_, number));
+}
+
+CtxLocalValue V8Ctx::CreateBooleanLocal(bool b) {
+  return ToCtxLocalValue(v8::Boolean::New(isolate_, b));
+}
+
+CtxLocalValue V8Ctx::CreateStringLocal(const unicode_string_view& str_view) {
+  if (str_view.encoding() == unicode_string_view::Encoding::Unkown) {
+    return CtxLocalValue();
+  }
+  return ToCtxLocalValue(CreateV8String(str_view));
+}
+
+bool V8Ctx::GetValueNumber(CtxLocalValue value, double* result) {
+  if (value.IsEmpty() || !result) {
+    return false;
+  }
+  v8::Local<v8::Value> handle_value = ToV8LocalValue(value);
+  if (!handle_value->IsNumber()) {
+    return false;
+  }
+  *result = handle_value.As<v8::Number>()->Value();
+  return true;
+}
+
+bool V8Ctx::GetValueNumber(CtxLocalValue value, int32_t* result) {
+  if (value.IsEmpty() || !result) {
+    return false;
+  }
+  v8::Local<v8::Value> handle_value = ToV8LocalValue(value);
+  if (!handle_value->IsInt32()) {
+    return false;
+  }
+  *result = handle_value.As<v8::Int32>()->Value();
+  return true;
+}
+
+bool V8Ctx::GetValueBoolean(CtxLocalValue value, bool* result) {
+  if (value.IsEmpty() || !result) {
+    return false;
+  }
+  v8::Local<v8::Value> handle_value = ToV8LocalValue(value);
+  if (handle_value->IsBoolean()) {
+    *result = handle_value.As<v8::Boolean>()->Value();
+    return true;
+  }
+  if (handle_value->IsBooleanObject()) {
+    *result = handle_value.As<v8::BooleanObject>()->ValueOf();
+    return true;
+  }
+  return false;
+}
+
+bool V8Ctx::GetValueString(CtxLocalValue value, unicode_string_view* result) {
+  if (value.IsEmpty() || !result) {
+    return false;
+  }
+  v8::Local<v8::Value> handle_value = ToV8LocalValue(value);
+  if (handle_value->IsString()) {
+    *result = ToStringView(handle_value.As<v8::String>());
+    return true;
+  }
+  if (handle_value->IsStringObject()) {
+    *result = ToStringView(handle_value.As<v8::StringObject>()->ValueOf());
+    return true;
+  }
+  return false;
+}
+
+bool V8Ctx::IsNullOrUndefined(CtxLocalValue value) {
+  if (value.IsEmpty()) {
+    return true;
+  }
+  return ToV8LocalValue(value)->IsNullOrUndefined();
+}
+
+bool V8Ctx::IsFunction(CtxLocalValue value) {
+  if (value.IsEmpty()) {
+    return false;
+  }
+  return ToV8LocalValue(value)->IsFunction();
+}
+
+std::shared_ptr<CtxValue> V8Ctx::GlobalizeLocal(CtxLocalValue value) {
+  if (value.IsEmpty()) {
+    return nullptr;
+  }
+  return std::make_shared<V8CtxValue>(isolate_, ToV8LocalValue(value));
 }
 
 unicode_string_view V8Ctx::ToStringView(v8::Local<v8::String> str) const {
@@ -1614,7 +2192,7 @@ bool V8Ctx::HasNamedProperty(const std::shared_ptr<CtxValue>& value,
 
   if (handle_value->IsMap()) {
     v8::Map* map = v8::Map::Cast(*handle_value);
-    v8::Local<v8::String> key = CreateV8String(name);
+    v8::Local<v8::String> key = CreateV8Name(name);
     if (key.IsEmpty()) {
       return false;
     }
@@ -1650,7 +2228,7 @@ std::shared_ptr<CtxValue> V8Ctx::CopyNamedProperty(
       return nullptr;
     }
 
-    v8::Local<v8::String> key = CreateV8String(name);
+    v8::Local<v8::String> key = CreateV8Name(name);
     if (key.IsEmpty()) {
       return nullptr;
     }
@@ -0,0 +1,205 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "core/napi/v8/script_streamer_v8.h"
+
+#include <string.h>
+
+#include <utility>
+
+#include "base/logging.h"
+#include "core/base/common.h"
+
+namespace hippy {
+namespace napi {
+
+// Hands the chunks over to V8's background parser, which blocks in
+// GetMoreData until the next one arrives.
+class V8ScriptStreamer::ChunkedSourceStream
+    : public v8::ScriptCompiler::ExternalSourceStream {
+ public:
+  ChunkedSourceStream() = default;
+  ~ChunkedSourceStream() override = default;
+
+  size_t GetMoreData(const uint8_t** src) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return !chunks_.empty() || is_finished_; });
+    if (chunks_.empty()) {
+      *src = nullptr;
+      return 0;
+    }
+    auto chunk = std::move(chunks_.front());
+    chunks_.pop_front();
+    // V8 takes ownership and frees the chunk with delete[].
+    *src = chunk.first.release();
+    return chunk.second;
+  }
+
+  void AddChunk(const uint8_t* data, size_t length) {
+    std::unique_ptr<uint8_t[]> chunk(new uint8_t[length]);
+    memcpy(chunk.get(), data, length);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      chunks_.emplace_back(std::move(chunk), length);
+    }
+    cv_.notify_one();
+  }
+
+  void Finish() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      is_finished_ = true;
+    }
+    cv_.notify_one();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::pair<std::unique_ptr<uint8_t[]>, size_t>> chunks_;
+  bool is_finished_ = false;
+};
+
+namespace {
+
+// Hands the source over to V8 without copying it, for ASCII scripts.
+class OneByteSourceResource : public v8::String::ExternalOneByteStringResource {
+ public:
+  explicit OneByteSourceResource(V8ScriptStreamer::u8string&& source)
+      : source_(std::move(source)) {}
+
+  const char* data() const override { return reinterpret_cast<const char*>(source_.c_str()); }
+  size_t length() const override { return source_.length(); }
+
+ private:
+  V8ScriptStreamer::u8string source_;
+};
+
+bool IsAscii(const V8ScriptStreamer::char8_t_* data, size_t length) {
+  for (size_t i = 0; i < length; ++i) {
+    if (data[i] & 0x80) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+V8ScriptStreamer::V8ScriptStreamer(v8::Isolate* isolate)
+    : isolate_(isolate), stream_(new ChunkedSourceStream()) {
+  v8::HandleScope handle_scope(isolate_);
+  streamed_source_ = std::make_unique<v8::ScriptCompiler::StreamedSource>(
+      std::unique_ptr<v8::ScriptCompiler::ExternalSourceStream>(stream_),
+      v8::ScriptCompiler::StreamedSource::UTF8);
+#if V8_MAJOR_VERSION >= 9
+  task_.reset(v8::ScriptCompiler::StartStreaming(isolate_, streamed_source_.get()));
+#else
+  task_.reset(v8::ScriptCompiler::StartStreamingScript(isolate_, streamed_source_.get()));
+#endif
+}
+
+V8ScriptStreamer::~V8ScriptStreamer() {
+  // Unblocks a compile task still waiting for data.
+  stream_->Finish();
+  if (compile_thread_) {
+    compile_thread_->Join();
+  }
+}
+
+void V8ScriptStreamer::AddChunk(const char8_t_* data, size_t length) {
+  if (!length) {
+    return;
+  }
+  if (is_one_byte_) {
+    is_one_byte_ = IsAscii(data, length);
+  }
+  source_.append(data, length);
+  stream_->AddChunk(reinterpret_cast<const uint8_t*>(data), length);
+}
+
+void V8ScriptStreamer::Finish() {
+  stream_->Finish();
+}
+
+void V8ScriptStreamer::Cancel() {
+  stream_->Finish();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (task_state_ == TaskState::kPending) {
+    task_state_ = TaskState::kDone;
+  }
+}
+
+void V8ScriptStreamer::StartCompileThread() {
+  compile_thread_ = std::make_unique<CompileThread>(this);
+  compile_thread_->Start();
+}
+
+void V8ScriptStreamer::RunCompileTask() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (task_state_ != TaskState::kPending) {
+      return;
+    }
+    task_state_ = TaskState::kRunning;
+  }
+  task_->Run();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_state_ = TaskState::kDone;
+  }
+  cv_.notify_all();
+}
+
+v8::MaybeLocal<v8::Script> V8ScriptStreamer::Compile(v8::Local<v8::Context> context,
+                                                     const v8::ScriptOrigin& origin) {
+  // Does nothing when the compile thread is on it, one that has not got to it
+  // yet must not keep the JS thread waiting.
+  RunCompileTask();
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return task_state_ == TaskState::kDone; });
+  }
+  size_t source_length = source_.length();
+  int length;
+  v8::Local<v8::String> source;
+  if (is_one_byte_) {
+    // The buffer becomes the string, V8 disposes of the resource with the
+    // script, or right away if it fails.
+    v8::String::NewExternalOneByte(isolate_, new OneByteSourceResource(std::move(source_)))
+        .ToLocal(&source);
+  } else if (hippy::base::numeric_cast<size_t, int>(source_length, length)) {
+    // V8 keeps non-ASCII sources as UTF-16, so this one is copied, but only
+    // until the string exists.
+    v8::String::NewFromUtf8(isolate_, reinterpret_cast<const char*>(source_.c_str()),
+                            v8::NewStringType::kNormal, length).ToLocal(&source);
+    u8string().swap(source_);
+  }
+  if (source.IsEmpty()) {
+    TDF_BASE_DLOG(ERROR) << "V8ScriptStreamer source too long, length = " << source_length;
+    return v8::MaybeLocal<v8::Script>();
+  }
+  return v8::ScriptCompiler::Compile(context, streamed_source_.get(), source, origin);
+}
+
+}  // namespace napi
+}  // namespace hippy
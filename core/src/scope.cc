@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "base/logging.h"
+#include "core/base/base_time.h"
 #include "core/modules/module_register.h"
 #include "core/napi/native_source_code.h"
 #include "core/task/javascript_task.h"
@@ -92,16 +93,34 @@ void Scope::WillExit() {
 void Scope::Initialized() {
   TDF_BASE_DLOG(INFO) << "Scope Initialized";
   engine_->Enter();
-  context_ = engine_->GetVM()->CreateContext();
-  if (context_ == nullptr) {
-    TDF_BASE_DLOG(ERROR) << "CreateContext return nullptr";
-    return;
-  }
+  startup_timeline_->Merge(*StartupTimeline::GetProcessTimeline());
+  startup_timeline_->Merge(engine_->GetStartupTimeline());
   std::shared_ptr<Scope> self = wrapper_->scope_.lock();
   if (!self) {
     TDF_BASE_DLOG(ERROR) << "Scope wrapper_ error_";
     return;
   }
+  std::shared_ptr<Scope> recycled = engine_->TakeRecycledScope();
+  {
+    StartupTimeline::ScopedPhase phase(startup_timeline_.get(),
+                                       StartupTimeline::Phase::kContextCreation);
+    if (recycled) {
+      TDF_BASE_DLOG(INFO) << "Scope adopts recycled context";
+      AdoptRecycledScope(recycled.get(), self);
+    } else {
+      context_ = engine_->TakeWarmContext();
+    }
+    if (!context_) {
+      context_ = engine_->GetVM()->CreateContext();
+    }
+  }
+  if (context_ == nullptr) {
+    TDF_BASE_DLOG(ERROR) << "CreateContext return nullptr";
+    return;
+  }
+#ifdef JS_V8
+  std::static_pointer_cast<hippy::napi::V8Ctx>(context_)->SetStartupTimeline(startup_timeline_);
+#endif
   RegisterMap::const_iterator it =
       map_->find(hippy::base::kContextCreatedCBKey);
   if (it != map_->end()) {
@@ -113,40 +132,95 @@ void Scope::Initialized() {
       map_->erase(it);
     }
   }
+  // A recycled context keeps its global modules and bootstrap.
+  if (!binding_data_ && !Bootstrap(self)) {
+    return;
+  }
+
+  it = map_->find(hippy::base::KScopeInitializedCBKey);
+  if (it != map_->end()) {
+    RegisterFunction f = it->second;
+    if (f) {
+      TDF_BASE_DLOG(INFO) << "run SCOPE_INITIALIZED begin";
+      f(wrapper_.get());
+      TDF_BASE_DLOG(INFO) << "run SCOPE_INITIALIZED end";
+      map_->erase(it);
+    }
+  }
+}
+
+bool Scope::Bootstrap(const std::shared_ptr<Scope>& self) {
   TDF_BASE_DLOG(INFO) << "Scope RegisterGlobalInJs";
-  context_->RegisterGlobalModule(self,
-                                 ModuleRegister::instance()->GetGlobalList());
+  {
+    StartupTimeline::ScopedPhase phase(startup_timeline_.get(),
+                                       StartupTimeline::Phase::kGlobalModuleRegistration);
+    context_->RegisterGlobalModule(self,
+                                   ModuleRegister::instance()->GetGlobalList());
+  }
   ModuleClassMap map(ModuleRegister::instance()->GetInternalList());
   binding_data_ = std::make_unique<BindingData>(self, map);
 
+  uint64_t bootstrap_begin = hippy::base::MonotonicallyIncreasingTimeInUs();
   auto source_code = hippy::GetNativeSourceCode(kHippyBootstrapJSName);
   TDF_BASE_DCHECK(source_code.data_ && source_code.length_);
-  unicode_string_view str_view(reinterpret_cast<const unicode_string_view::char8_t_ *>(source_code.data_),
-                               source_code.length_);
-  std::shared_ptr<CtxValue> function = context_->RunScript(
-      str_view, kHippyBootstrapJSName);
+  std::shared_ptr<CtxValue> function = context_->GetNativeSourceFunction(kHippyBootstrapJSName);
+  if (!function) {
+    unicode_string_view str_view(reinterpret_cast<const unicode_string_view::char8_t_ *>(source_code.data_),
+                                 source_code.length_);
+    function = context_->RunScript(str_view, kHippyBootstrapJSName);
+  }
 
   bool is_func = context_->IsFunction(function);
   TDF_BASE_CHECK(is_func) << "bootstrap return not function, len = " << source_code.length_;
   // TODO(super): The following statement will be removed when TDF_BASE_CHECK will be cause abort
   if (!is_func) {
-    return;
+    return false;
   }
 
   std::shared_ptr<CtxValue> internal_binding_fn =
       hippy::napi::GetInternalBindingFn(self);
   std::shared_ptr<CtxValue> argv[] = {internal_binding_fn};
   context_->CallFunction(function, 1, argv);
+  startup_timeline_->Record(StartupTimeline::Phase::kBootstrap, bootstrap_begin,
+                            hippy::base::MonotonicallyIncreasingTimeInUs());
+#ifdef JS_V8
+  std::static_pointer_cast<hippy::napi::V8Ctx>(context_)->SaveGlobalNames();
+#endif
+  return true;
+}
 
-  it = map_->find(hippy::base::KScopeInitializedCBKey);
-  if (it != map_->end()) {
-    RegisterFunction f = it->second;
-    if (f) {
-      TDF_BASE_DLOG(INFO) << "run SCOPE_INITIALIZED begin";
-      f(wrapper_.get());
-      TDF_BASE_DLOG(INFO) << "run SCOPE_INITIALIZED end";
-      map_->erase(it);
-    }
+bool Scope::Recycle() {
+#ifdef JS_V8
+  auto context = std::static_pointer_cast<hippy::napi::V8Ctx>(context_);
+  if (!context || !binding_data_ || !context->HasSavedGlobalNames()) {
+    return false;
+  }
+  TDF_BASE_DLOG(INFO) << "Scope Recycle";
+  std::shared_ptr<CtxValue> fn = context->GetJsFn(kDeallocFuncName);
+  if (context->IsFunction(fn)) {
+    context->CallFunction(fn, 0, nullptr);
+  }
+  is_recycled_ = true;
+  // Their destructors cancel what they still have pending, e.g. timers.
+  module_class_map_.clear();
+  context->DeleteGlobalsAddedSinceSave();
+  return true;
+#else
+  return false;
+#endif
+}
+
+void Scope::AdoptRecycledScope(Scope* recycled, const std::shared_ptr<Scope>& self) {
+  context_ = std::move(recycled->context_);
+  module_value_map_ = std::move(recycled->module_value_map_);
+  function_data_ = std::move(recycled->function_data_);
+  for (auto& data : function_data_) {
+    data->scope_ = self;
+  }
+  // Still pointed to by the context, see GetInternalBindingFn.
+  binding_data_ = std::move(recycled->binding_data_);
+  if (binding_data_) {
+    binding_data_->scope_ = self;
   }
 }
 
@@ -237,3 +311,43 @@ std::shared_ptr<CtxValue> Scope::RunJSSync(const unicode_string_view& data,
   std::shared_ptr<CtxValue> ret = future.get();
   return ret;
 }
+
+#if defined(ENABLE_COROUTINE)
+namespace {
+
+// Takes everything by value, the coroutine frame owns the source until the
+// script has run.
+hippy::base::Async<std::shared_ptr<CtxValue>> RunScriptOnJSThread(
+    std::weak_ptr<hippy::napi::Ctx> weak_context,
+    std::shared_ptr<JavaScriptTaskRunner> runner,
+    unicode_string_view data,
+    unicode_string_view name) {
+  if (!runner->IsJsThread()) {
+    co_await runner->Schedule();
+  }
+
+  std::shared_ptr<CtxValue> rst = nullptr;
+#ifdef JS_V8
+  auto context = std::static_pointer_cast<hippy::napi::V8Ctx>(weak_context.lock());
+  if (context) {
+    // Always copied, an external string would outlive the frame.
+    rst = context->RunScript(data, name, false, nullptr, true);
+  }
+#else
+  auto context = weak_context.lock();
+  if (context) {
+    rst = context->RunScript(data, name);
+  }
+#endif
+  co_return rst;
+}
+
+}  // namespace
+
+hippy::base::Async<std::shared_ptr<CtxValue>> Scope::RunJSAsync(const unicode_string_view& data,
+                                                                const unicode_string_view& name) {
+  // Not a coroutine itself, Async starts lazily and the scope may be gone by
+  // the time it is awaited.
+  return RunScriptOnJSThread(context_, engine_->GetJSRunner(), data, name);
+}
+#endif
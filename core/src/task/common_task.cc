@@ -25,3 +25,7 @@
 void CommonTask::Run() {
   func_();
 }
+
+void CommonTask::OnCanceled() {
+  func_ = nullptr;
+}
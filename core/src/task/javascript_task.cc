@@ -31,3 +31,7 @@ void JavaScriptTask::Run() {
     callback();
   }
 }
+
+void JavaScriptTask::OnCanceled() {
+  callback = nullptr;
+}
@@ -22,18 +22,412 @@
 
 #include "core/task/javascript_task_runner.h"
 
+#include <algorithm>
 #include <memory>
 
+#include "base/logging.h"
+#include "core/base/base_time.h"
 #include "core/base/task.h"
+#include "core/base/task_telemetry.h"
+#include "core/task/javascript_thread_pool.h"
 
-JavaScriptTaskRunner::JavaScriptTaskRunner() {
-  SetName("hippy.js");
+namespace {
+
+using DelayedTimeInMs = hippy::base::TaskRunner::DelayedTimeInMs;
+
+// Idle period used when the host does not drive frames, same as the limit
+// used for requestIdleCallback in browsers.
+constexpr DelayedTimeInMs kMaxIdlePeriodInMs = 50;
+// Without a vsync for this long the host is assumed to have stopped drawing.
+constexpr DelayedTimeInMs kVsyncTimeoutInMs = 100;
+// A pooled runner gives its thread back after this long if other runners are
+// waiting for one.
+constexpr uint64_t kMaxSliceTimeInUs = 10 * 1000;
+
+// Values of Task::runner_queue_. Pending ones are only read and written
+// under `frame_mutex_`, the others only on the runner thread.
+enum FrameQueue : uint8_t {
+  kNoFrameQueue,
+  kPendingAnimationQueue,
+  kPendingIdleQueue,
+  kAnimationQueue,
+  kIdleQueue,
+};
+
+// Erases `task` from `container`, true if it was there.
+template <typename Container>
+bool EraseTask(Container* container, const hippy::base::Task* task) {
+  auto it = std::find_if(container->begin(), container->end(),
+                         [task](const auto& item) { return item.get() == task; });
+  if (it == container->end()) {
+    return false;
+  }
+  container->erase(it);
+  return true;
+}
+
+// Pooled runner whose slice is running on the current thread.
+thread_local const JavaScriptTaskRunner* current_pooled_runner = nullptr;
+
+}  // namespace
+
+JavaScriptTaskRunner::JavaScriptTaskRunner(const SchedulingParams& params)
+    : TaskRunner(Options("hippy.js").set_scheduling_params(params)) {}
+
+JavaScriptTaskRunner::JavaScriptTaskRunner(std::shared_ptr<JavaScriptThreadPool> pool)
+    : TaskRunner(Options("hippy.js")), pool_(std::move(pool)) {
+  pool_->Register(this);
+}
+
+JavaScriptTaskRunner::~JavaScriptTaskRunner() {
+  if (destroyed_flag_) {
+    // Destroyed by one of its own tasks, tells RunSlice to stop touching it.
+    *destroyed_flag_ = true;
+  }
+  if (pool_) {
+    pool_->Unregister(this);
+  }
+}
+
+void JavaScriptTaskRunner::Run() {
+  while (true) {
+    std::shared_ptr<Task> task = GetNext();
+    if (task == nullptr) {
+      return;
+    }
+
+    if (!task->canceled_.load(std::memory_order_acquire)) {
+      RunTaskWithFrameAccounting(task.get());
+    }
+  }
+}
+
+void JavaScriptTaskRunner::RunTaskWithFrameAccounting(Task* task) {
+  uint64_t begin = hippy::base::MonotonicallyIncreasingTimeInUs();
+  RunTask(task);
+  AccountTaskTime(hippy::base::MonotonicallyIncreasingTimeInUs() - begin);
+}
+
+void JavaScriptTaskRunner::Terminate() {
+  if (!pool_) {
+    TaskRunner::Terminate();
+    return;
+  }
+  if (is_terminated_.exchange(true)) {
+    TDF_BASE_DLOG(INFO) << "TaskRunner has been terminated";
+    return;
+  }
+  // The pool drops the runner once a slice finds nothing left to run.
+  Unpark();
+  if (IsJsThread()) {
+    TDF_BASE_DLOG(ERROR) << "terminate in task";
+    return;
+  }
+  pool_->WaitForTermination(this);
+}
+
+void JavaScriptTaskRunner::SetSliceCallbacks(std::function<void()> on_enter,
+                                             std::function<void()> on_exit) {
+  on_slice_enter_ = std::move(on_enter);
+  on_slice_exit_ = std::move(on_exit);
 }
 
 bool JavaScriptTaskRunner::IsJsThread() {
+  if (pool_) {
+    return current_pooled_runner == this;
+  }
   return this->Id() == hippy::base::ThreadId::GetCurrent();
 }
 
+void JavaScriptTaskRunner::Unpark() {
+  // Also wakes up PauseThreadForInspector, which parks the pool thread.
+  TaskRunner::Unpark();
+  if (pool_ && RequestSlice()) {
+    pool_->Schedule(this);
+  }
+}
+
+bool JavaScriptTaskRunner::RequestSlice() {
+  uint32_t state = slice_state_.load(std::memory_order_acquire);
+  while (true) {
+    uint32_t next_state;
+    if (state == kIdle) {
+      next_state = kScheduled;
+    } else if (state == kRunning) {
+      next_state = kRunningNotified;
+    } else {
+      return false;
+    }
+    if (slice_state_.compare_exchange_weak(state, next_state, std::memory_order_acq_rel)) {
+      return state == kIdle;
+    }
+  }
+}
+
+bool JavaScriptTaskRunner::RunSlice(DelayedTimeInMs* wake_up_time) {
+  slice_state_.store(kRunning, std::memory_order_release);
+  current_pooled_runner = this;
+  if (on_slice_enter_) {
+    on_slice_enter_();
+  }
+
+  uint64_t slice_end = hippy::base::MonotonicallyIncreasingTimeInUs() + kMaxSliceTimeInUs;
+  bool is_slice_used_up = false;
+  bool is_destroyed = false;
+  destroyed_flag_ = &is_destroyed;
+  while (std::shared_ptr<Task> task = TakeNext()) {
+    if (!task->canceled_.load(std::memory_order_acquire)) {
+      // RunTaskWithFrameAccounting, except that the task may destroy the
+      // runner, the telemetry included.
+      hippy::base::TaskTelemetry* telemetry = telemetry_.load(std::memory_order_acquire);
+      uint64_t begin = hippy::base::MonotonicallyIncreasingTimeInUs();
+      uint64_t start_time = telemetry ? telemetry->OnTaskStarted(task.get()) : 0;
+      task->Run();
+      if (is_destroyed) {
+        // The pool has already dropped it, see the destructor.
+        current_pooled_runner = nullptr;
+        return false;
+      }
+      if (telemetry) {
+        telemetry->OnTaskFinished(task.get(), start_time);
+      }
+      AccountTaskTime(hippy::base::MonotonicallyIncreasingTimeInUs() - begin);
+    }
+    if (hippy::base::MonotonicallyIncreasingTimeInUs() >= slice_end) {
+      is_slice_used_up = true;
+      break;
+    }
+  }
+
+  destroyed_flag_ = nullptr;
+  if (on_slice_exit_) {
+    on_slice_exit_();
+  }
+  current_pooled_runner = nullptr;
+  if (is_slice_used_up) {
+    slice_state_.store(kScheduled, std::memory_order_release);
+    return true;
+  }
+
+  DelayedTimeInMs now = hippy::base::MonotonicallyIncreasingTime();
+  *wake_up_time = std::min(GetNextWakeUpTime(now), timer_wheel_.NextExpiryTime());
+  // Once idle another thread may pick the runner up, do not touch it after.
+  uint32_t state = kRunning;
+  if (slice_state_.compare_exchange_strong(state, kIdle, std::memory_order_acq_rel)) {
+    return false;
+  }
+  slice_state_.store(kScheduled, std::memory_order_release);
+  return true;
+}
+
+void JavaScriptTaskRunner::OnVsync(DelayedTimeInMs frame_time,
+                                   DelayedTimeInMs frame_interval) {
+  {
+    std::lock_guard<std::mutex> lock(frame_mutex_);
+    has_pending_vsync_ = true;
+    pending_frame_time_ = frame_time;
+    pending_frame_interval_ = frame_interval;
+    has_pending_frame_work_ = true;
+  }
+  Unpark();
+}
+
+void JavaScriptTaskRunner::RequestAnimationFrame(std::shared_ptr<Task> task) {
+  if (!task) {
+    return;
+  }
+  task->runner_.store(this, std::memory_order_release);
+  {
+    std::lock_guard<std::mutex> lock(frame_mutex_);
+    task->runner_queue_.store(kPendingAnimationQueue, std::memory_order_relaxed);
+    pending_animation_callbacks_.push_back(std::move(task));
+  }
+  // Animation callbacks wait for the next vsync, no need to wake the runner.
+}
+
+void JavaScriptTaskRunner::PostIdleTask(std::shared_ptr<IdleTask> task,
+                                        DelayedTimeInMs timeout) {
+  if (!task) {
+    return;
+  }
+  if (timeout > 0) {
+    task->timeout_time_ = hippy::base::MonotonicallyIncreasingTime() + timeout;
+  }
+  task->runner_.store(this, std::memory_order_release);
+  {
+    std::lock_guard<std::mutex> lock(frame_mutex_);
+    task->runner_queue_.store(kPendingIdleQueue, std::memory_order_relaxed);
+    pending_idle_tasks_.push_back(std::move(task));
+    has_pending_frame_work_ = true;
+  }
+  Unpark();
+}
+
+JavaScriptTaskRunner::FrameStats JavaScriptTaskRunner::GetFrameStats() {
+  std::lock_guard<std::mutex> lock(frame_mutex_);
+  return frame_stats_;
+}
+
+void JavaScriptTaskRunner::MergePendingFrameWork(DelayedTimeInMs now) {
+  std::lock_guard<std::mutex> lock(frame_mutex_);
+  has_pending_frame_work_ = false;
+  for (auto& task : pending_idle_tasks_) {
+    task->runner_queue_.store(kIdleQueue, std::memory_order_relaxed);
+    idle_tasks_.push_back(std::move(task));
+  }
+  pending_idle_tasks_.clear();
+  if (has_pending_vsync_) {
+    has_pending_vsync_ = false;
+    BeginFrame(pending_frame_time_, pending_frame_interval_, now);
+  }
+}
+
+// Called with `frame_mutex_` held.
+void JavaScriptTaskRunner::BeginFrame(DelayedTimeInMs frame_time,
+                                      DelayedTimeInMs frame_interval,
+                                      DelayedTimeInMs now) {
+  if (has_frame_) {
+    uint64_t busy_time = current_frame_.animation_time_in_us + current_frame_.task_time_in_us;
+    ++frame_stats_.frame_count;
+    if (busy_time > current_frame_.frame_budget_in_us) {
+      ++frame_stats_.over_budget_frame_count;
+    }
+    frame_stats_.frame_budget_in_us = current_frame_.frame_budget_in_us;
+    frame_stats_.animation_time_in_us = current_frame_.animation_time_in_us;
+    frame_stats_.task_time_in_us = current_frame_.task_time_in_us;
+    frame_stats_.idle_time_in_us = current_frame_.idle_time_in_us;
+  }
+
+  has_frame_ = true;
+  current_frame_ = FrameStats();
+  current_frame_.frame_budget_in_us = frame_interval * 1000;
+  frame_deadline_ = frame_time + frame_interval;
+  last_vsync_time_ = now;
+  // Callbacks requested while this frame runs belong to the next one.
+  for (auto& task : pending_animation_callbacks_) {
+    task->runner_queue_.store(kAnimationQueue, std::memory_order_relaxed);
+    animation_callbacks_.push_back(std::move(task));
+  }
+  pending_animation_callbacks_.clear();
+}
+
+bool JavaScriptTaskRunner::IsInFrameMode(DelayedTimeInMs now) const {
+  return has_frame_ && now - last_vsync_time_ <= kVsyncTimeoutInMs;
+}
+
+// Timers never wait in a frame queue, only tasks that do are searched for,
+// and only in the queue they were put in.
+void JavaScriptTaskRunner::RemoveCanceledTask(Task* task) {
+  uint8_t queue = task->runner_queue_.load(std::memory_order_relaxed);
+  if (queue == kNoFrameQueue || task->runner_.load(std::memory_order_acquire) != this) {
+    TaskRunner::RemoveCanceledTask(task);
+    return;
+  }
+
+  bool is_removed = false;
+  if (queue == kAnimationQueue) {
+    is_removed = EraseTask(&animation_callbacks_, task);
+  } else if (queue == kIdleQueue) {
+    is_removed = EraseTask(&idle_tasks_, task);
+  } else {
+    // Only this thread merges pending tasks, the queue read above still holds.
+    std::lock_guard<std::mutex> lock(frame_mutex_);
+    if (queue == kPendingAnimationQueue) {
+      is_removed = EraseTask(&pending_animation_callbacks_, task);
+    } else {
+      is_removed = EraseTask(&pending_idle_tasks_, task);
+    }
+  }
+  if (is_removed) {
+    task->runner_queue_.store(kNoFrameQueue, std::memory_order_relaxed);
+    task->OnCanceled();
+  }
+}
+
+std::shared_ptr<hippy::base::Task> JavaScriptTaskRunner::GetNextUrgentTask(
+    DelayedTimeInMs now) {
+  current_task_kind_ = TaskKind::kNormal;
+  if (has_pending_frame_work_.load(std::memory_order_acquire)) {
+    MergePendingFrameWork(now);
+  }
+  if (animation_callbacks_.empty()) {
+    return nullptr;
+  }
+  std::shared_ptr<Task> task = std::move(animation_callbacks_.front());
+  animation_callbacks_.pop_front();
+  task->runner_queue_.store(kNoFrameQueue, std::memory_order_relaxed);
+  current_task_kind_ = TaskKind::kAnimation;
+  return task;
+}
+
+std::shared_ptr<hippy::base::Task> JavaScriptTaskRunner::GetNextIdleTask(
+    DelayedTimeInMs now) {
+  while (!idle_tasks_.empty() &&
+         idle_tasks_.front()->canceled_.load(std::memory_order_acquire)) {
+    idle_tasks_.front()->runner_queue_.store(kNoFrameQueue, std::memory_order_relaxed);
+    idle_tasks_.pop_front();
+  }
+  if (idle_tasks_.empty()) {
+    return nullptr;
+  }
+
+  DelayedTimeInMs deadline =
+      IsInFrameMode(now) ? frame_deadline_ : now + kMaxIdlePeriodInMs;
+  std::shared_ptr<IdleTask> task;
+  if (now < deadline) {
+    task = std::move(idle_tasks_.front());
+    idle_tasks_.pop_front();
+    task->deadline_ = {deadline - now, false};
+  } else {
+    for (auto it = idle_tasks_.begin(); it != idle_tasks_.end(); ++it) {
+      if ((*it)->timeout_time_ && (*it)->timeout_time_ <= now) {
+        task = std::move(*it);
+        idle_tasks_.erase(it);
+        task->deadline_ = {0, true};
+        break;
+      }
+    }
+  }
+  if (task) {
+    task->runner_queue_.store(kNoFrameQueue, std::memory_order_relaxed);
+    current_task_kind_ = TaskKind::kIdle;
+  }
+  return task;
+}
+
+hippy::base::TaskRunner::DelayedTimeInMs JavaScriptTaskRunner::GetNextWakeUpTime(
+    DelayedTimeInMs now) {
+  if (idle_tasks_.empty()) {
+    return kNoWakeUpTime;
+  }
+  // The next vsync wakes the runner up, unless the host stops sending them.
+  DelayedTimeInMs wake_up_time =
+      IsInFrameMode(now) ? last_vsync_time_ + kVsyncTimeoutInMs + 1 : kNoWakeUpTime;
+  for (const auto& task : idle_tasks_) {
+    if (task->timeout_time_) {
+      wake_up_time = std::min(wake_up_time, task->timeout_time_);
+    }
+  }
+  return wake_up_time;
+}
+
+void JavaScriptTaskRunner::AccountTaskTime(uint64_t time_in_us) {
+  if (!has_frame_) {
+    return;
+  }
+  switch (current_task_kind_) {
+    case TaskKind::kAnimation:
+      current_frame_.animation_time_in_us += time_in_us;
+      break;
+    case TaskKind::kIdle:
+      current_frame_.idle_time_in_us += time_in_us;
+      break;
+    default:
+      current_frame_.task_time_in_us += time_in_us;
+      break;
+  }
+}
+
 // keep the same with TaskRunner::run
 void JavaScriptTaskRunner::PauseThreadForInspector() {
   is_inspector_call_pause_ = true;
@@ -43,7 +437,7 @@ void JavaScriptTaskRunner::PauseThreadForInspector() {
       return;
     }
 
-    if (!task->canceled_) {
+    if (!task->canceled_.load(std::memory_order_acquire)) {
       task->Run();
     }
   }
@@ -0,0 +1,195 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "core/task/javascript_thread_pool.h"
+
+#include <algorithm>
+#include <chrono>  // NOLINT(build/c++11)
+
+#include "base/logging.h"
+#include "core/base/base_time.h"
+#include "core/task/javascript_task_runner.h"
+
+namespace {
+
+constexpr uint32_t kDefaultPoolSize = 2;
+
+}  // namespace
+
+JavaScriptThreadPool::JavaScriptThreadPool(uint32_t pool_size)
+    : pool_size_(std::max(pool_size, 1u)) {
+  for (uint32_t i = 0; i < pool_size_; ++i) {
+    threads_.push_back(std::make_unique<PoolThread>(this));
+  }
+}
+
+JavaScriptThreadPool::~JavaScriptThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    terminated_ = true;
+  }
+  cv_.notify_all();
+  threads_.clear();
+}
+
+std::shared_ptr<JavaScriptThreadPool> JavaScriptThreadPool::GetInstance() {
+  static auto* instance = new std::shared_ptr<JavaScriptThreadPool>(
+      std::make_shared<JavaScriptThreadPool>(kDefaultPoolSize));
+  return *instance;
+}
+
+void JavaScriptThreadPool::Register(JavaScriptTaskRunner* runner) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  clients_.emplace(runner, Client());
+}
+
+void JavaScriptThreadPool::WaitForTermination(JavaScriptTaskRunner* runner) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  idle_cv_.wait(lock, [this, runner] { return clients_.find(runner) == clients_.end(); });
+}
+
+void JavaScriptThreadPool::Unregister(JavaScriptTaskRunner* runner) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto it = clients_.find(runner);
+  if (it == clients_.end()) {
+    return;
+  }
+  if (!runner->IsJsThread()) {
+    idle_cv_.wait(lock, [this, runner] {
+      auto client = clients_.find(runner);
+      return client == clients_.end() || client->second.running_count == 0;
+    });
+  }
+  RemoveClient(runner);
+}
+
+void JavaScriptThreadPool::Schedule(JavaScriptTaskRunner* runner) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (clients_.find(runner) == clients_.end()) {
+      return;
+    }
+    ready_runners_.push_back(runner);
+  }
+  cv_.notify_one();
+}
+
+// Called with `mutex_` held.
+void JavaScriptThreadPool::SetWakeUp(JavaScriptTaskRunner* runner, Client& client,
+                                     DelayedTimeInMs time) {
+  if (client.has_wake_up) {
+    if (client.wake_up->first == time) {
+      return;
+    }
+    wake_ups_.erase(client.wake_up);
+  }
+  client.wake_up = wake_ups_.emplace(time, runner);
+  client.has_wake_up = true;
+}
+
+// Called with `mutex_` held.
+void JavaScriptThreadPool::RemoveClient(JavaScriptTaskRunner* runner) {
+  auto it = clients_.find(runner);
+  if (it == clients_.end()) {
+    return;
+  }
+  if (it->second.has_wake_up) {
+    wake_ups_.erase(it->second.wake_up);
+  }
+  clients_.erase(it);
+  ready_runners_.erase(std::remove(ready_runners_.begin(), ready_runners_.end(), runner),
+                       ready_runners_.end());
+  idle_cv_.notify_all();
+}
+
+void JavaScriptThreadPool::RunLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!terminated_) {
+    DelayedTimeInMs now = hippy::base::MonotonicallyIncreasingTime();
+    while (!wake_ups_.empty() && wake_ups_.begin()->first <= now) {
+      JavaScriptTaskRunner* runner = wake_ups_.begin()->second;
+      clients_[runner].has_wake_up = false;
+      wake_ups_.erase(wake_ups_.begin());
+      if (runner->RequestSlice()) {
+        ready_runners_.push_back(runner);
+      }
+    }
+
+    if (ready_runners_.empty()) {
+      if (wake_ups_.empty()) {
+        cv_.wait(lock);
+      } else {
+        cv_.wait_for(lock, std::chrono::milliseconds(wake_ups_.begin()->first - now));
+      }
+      continue;
+    }
+
+    JavaScriptTaskRunner* runner = ready_runners_.front();
+    ready_runners_.pop_front();
+    ++clients_[runner].running_count;
+    lock.unlock();
+    DelayedTimeInMs wake_up_time = JavaScriptTaskRunner::kNoWakeUpTime;
+    bool run_again = runner->RunSlice(&wake_up_time);
+    lock.lock();
+
+    auto it = clients_.find(runner);
+    if (it == clients_.end()) {
+      // Destroyed by one of its own tasks.
+      continue;
+    }
+    Client& client = it->second;
+    --client.running_count;
+    if (run_again) {
+      // Behind every runner that was already waiting.
+      ready_runners_.push_back(runner);
+      continue;
+    }
+    if (runner->is_terminated_.load(std::memory_order_acquire)) {
+      // A scheduled runner still has tasks posted before Terminate to run.
+      if (client.running_count == 0 &&
+          runner->slice_state_.load(std::memory_order_acquire) == JavaScriptTaskRunner::kIdle) {
+        TDF_BASE_DLOG(INFO) << "JavaScriptThreadPool runner terminated";
+        RemoveClient(runner);
+      }
+      continue;
+    }
+    if (wake_up_time != JavaScriptTaskRunner::kNoWakeUpTime) {
+      SetWakeUp(runner, client, wake_up_time);
+    }
+    if (client.running_count == 0) {
+      idle_cv_.notify_all();
+    }
+  }
+}
+
+JavaScriptThreadPool::PoolThread::PoolThread(JavaScriptThreadPool* pool)
+    : Thread(Options("hippy.js")), pool_(pool) {
+  Start();
+}
+
+JavaScriptThreadPool::PoolThread::~PoolThread() {
+  Join();
+}
+
+void JavaScriptThreadPool::PoolThread::Run() {
+  pool_->RunLoop();
+}
@@ -0,0 +1,140 @@
+/*
+ *
+ * Tencent is pleased to support the open source community by making
+ * Hippy available.
+ *
+ * Copyright (C) 2022 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "core/task/shared_worker_pool.h"
+
+#include <algorithm>
+#include <thread>  // NOLINT(build/c++11)
+
+#include "base/logging.h"
+#include "core/task/worker_task_runner.h"
+
+namespace {
+
+constexpr uint32_t kMinPoolSize = 2;
+constexpr uint32_t kMaxPoolSize = 4;
+
+// Client whose task the current pool thread is running, if any.
+thread_local const void* running_client = nullptr;
+
+}  // namespace
+
+SharedWorkerPool::SharedWorkerPool(uint32_t pool_size) : pool_size_(std::max(pool_size, 1u)) {
+  for (uint32_t i = 0; i < pool_size_; ++i) {
+    threads_.push_back(std::make_unique<PoolThread>(this));
+  }
+}
+
+SharedWorkerPool::~SharedWorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    terminated_ = true;
+  }
+  cv_.notify_all();
+  threads_.clear();
+}
+
+std::shared_ptr<SharedWorkerPool> SharedWorkerPool::GetInstance() {
+  static auto* instance = new std::shared_ptr<SharedWorkerPool>([] {
+    uint32_t core_count = std::thread::hardware_concurrency();
+    uint32_t pool_size = std::clamp(core_count / 2, kMinPoolSize, kMaxPoolSize);
+    TDF_BASE_DLOG(INFO) << "SharedWorkerPool create, pool_size = " << pool_size;
+    return std::make_shared<SharedWorkerPool>(pool_size);
+  }());
+  return *instance;
+}
+
+void SharedWorkerPool::Register(WorkerTaskRunner* runner) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto client = std::make_shared<Client>();
+  client->runner = runner;
+  clients_.push_back(std::move(client));
+}
+
+void SharedWorkerPool::Unregister(WorkerTaskRunner* runner) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto it = std::find_if(clients_.begin(), clients_.end(),
+                         [runner](const std::shared_ptr<Client>& client) {
+                           return client->runner == runner;
+                         });
+  if (it == clients_.end()) {
+    return;
+  }
+  std::shared_ptr<Client> client = *it;
+  clients_.erase(it);
+  // A runner may be terminated from one of its own tasks.
+  uint32_t self_count = running_client == client.get() ? 1 : 0;
+  idle_cv_.wait(lock, [&client, self_count] { return client->running_count == self_count; });
+}
+
+void SharedWorkerPool::Notify() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+  }
+  cv_.notify_one();
+}
+
+void SharedWorkerPool::RunLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!terminated_) {
+    std::shared_ptr<Client> client;
+    std::unique_ptr<CommonTask> task;
+    size_t client_count = clients_.size();
+    for (size_t i = 0; i < client_count; ++i) {
+      size_t index = (next_client_ + i) % client_count;
+      task = clients_[index]->runner->PopForPool();
+      if (task) {
+        client = clients_[index];
+        next_client_ = index + 1;
+        break;
+      }
+    }
+    if (!task) {
+      cv_.wait(lock);
+      continue;
+    }
+
+    ++client->running_count;
+    lock.unlock();
+    running_client = client.get();
+    client->runner->RunTask(task.get());
+    task = nullptr;
+    running_client = nullptr;
+    lock.lock();
+    if (--client->running_count == 0) {
+      idle_cv_.notify_all();
+    }
+  }
+}
+
+SharedWorkerPool::PoolThread::PoolThread(SharedWorkerPool* pool)
+    : Thread(Options("hippy.worker")), pool_(pool) {
+  Start();
+}
+
+SharedWorkerPool::PoolThread::~PoolThread() {
+  Join();
+}
+
+void SharedWorkerPool::PoolThread::Run() {
+  pool_->RunLoop();
+}
@@ -22,51 +22,238 @@
 
 #include "core/task/worker_task_runner.h"
 
+#include <algorithm>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iterator>
+#include <thread>  // NOLINT(build/c++11)
+
 #include "base/logging.h"
 #include "core/napi/js_native_api.h"
+#include "core/task/shared_worker_pool.h"
 
 const uint32_t WorkerTaskRunner::kDefaultTaskPriority = 10000;
 const uint32_t WorkerTaskRunner::kHighPriorityTaskPriority = 5000;
 const uint32_t WorkerTaskRunner::kLowPriorityTaskPriority = 15000;
 
-WorkerTaskRunner::WorkerTaskRunner(uint32_t pool_size) : pool_size_(pool_size) {
+namespace {
+
+// Fruitless passes over the queues before a worker that still sees pending
+// tasks goes to sleep.
+constexpr uint32_t kMaxSpinCount = 64;
+constexpr uint32_t kSpinSleepTimeInMs = 1;
+
+struct CurrentWorker {
+  const WorkerTaskRunner* runner = nullptr;
+  uint32_t index = 0;
+};
+
+thread_local CurrentWorker current_worker;
+
+}  // namespace
+
+WorkerTaskRunner::WorkerTaskRunner(uint32_t pool_size, const SchedulingParams& params)
+    : pool_size_(pool_size), scheduling_params_(params) {
+  // Every queue must exist before the first worker starts looking for work.
+  for (uint32_t i = 0; i < pool_size_; ++i) {
+    queues_.push_back(std::make_unique<WorkQueue>());
+  }
   for (uint32_t i = 0; i < pool_size_; ++i) {
-    thread_pool_.push_back(std::make_unique<WorkerThread>(this));
+    thread_pool_.push_back(std::make_unique<WorkerThread>(this, i));
   }
 }
 
+WorkerTaskRunner::WorkerTaskRunner(std::shared_ptr<SharedWorkerPool> shared_pool)
+    : pool_size_(1), shared_pool_(std::move(shared_pool)) {
+  queues_.push_back(std::make_unique<WorkQueue>());
+  shared_pool_->Register(this);
+}
+
+WorkerTaskRunner::~WorkerTaskRunner() {
+  if (shared_pool_) {
+    shared_pool_->Unregister(this);
+  }
+  delete telemetry_.load();
+}
+
+WorkerTaskRunner::Lane WorkerTaskRunner::GetLane(uint32_t priority) {
+  if (priority <= kHighPriorityTaskPriority) {
+    return kHighLane;
+  }
+  if (priority <= kDefaultTaskPriority) {
+    return kDefaultLane;
+  }
+  return kLowLane;
+}
+
+int32_t WorkerTaskRunner::GetCurrentWorkerIndex() const {
+  if (current_worker.runner != this) {
+    return -1;
+  }
+  return static_cast<int32_t>(current_worker.index);
+}
+
 void WorkerTaskRunner::PostTask(std::unique_ptr<CommonTask> task,
                                 uint32_t priority) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (terminated_) {
+  if (terminated_.load(std::memory_order_acquire) || queues_.empty()) {
     return;
   }
-  task_queue_.push(std::make_pair(priority, std::move(task)));
-  cv_.notify_one();
+
+  hippy::base::TaskTelemetry* telemetry = telemetry_.load(std::memory_order_acquire);
+  if (telemetry) {
+    telemetry->OnTaskPosted(task.get(), pending_count_.load(std::memory_order_relaxed), 0);
+  }
+
+  int32_t current_index = GetCurrentWorkerIndex();
+  uint32_t index = current_index >= 0
+                       ? static_cast<uint32_t>(current_index)
+                       : next_queue_.fetch_add(1, std::memory_order_relaxed) % pool_size_;
+  {
+    WorkQueue& queue = *queues_[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.lanes[GetLane(priority)].push_back(std::move(task));
+  }
+  pending_count_.fetch_add(1);
+
+  if (shared_pool_) {
+    shared_pool_->Notify();
+    return;
+  }
+  if (sleeping_count_.load() > 0) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+    }
+    cv_.notify_one();
+  }
 }
 
-std::unique_ptr<CommonTask> WorkerTaskRunner::GetNext() {
-  std::unique_lock<std::mutex> lock(mutex_);
-  while (true) {
-    if (!task_queue_.empty()) {
-      const Entry& entry = task_queue_.top();
-      std::unique_ptr<CommonTask> result =
-          std::move(const_cast<Entry&>(entry).second);
+std::unique_ptr<CommonTask> WorkerTaskRunner::PopLocal(uint32_t worker_index,
+                                                      Lane lane) {
+  WorkQueue& queue = *queues_[worker_index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  auto& tasks = queue.lanes[lane];
+  if (tasks.empty()) {
+    return nullptr;
+  }
+  std::unique_ptr<CommonTask> result = std::move(tasks.front());
+  tasks.pop_front();
+  return result;
+}
 
-      task_queue_.pop();
+std::unique_ptr<CommonTask> WorkerTaskRunner::Steal(uint32_t thief_index,
+                                                   Lane lane) {
+  for (uint32_t i = 1; i < pool_size_; ++i) {
+    WorkQueue& queue = *queues_[(thief_index + i) % pool_size_];
+    // Never wait for a busy victim, just move on to the next one.
+    std::unique_lock<std::mutex> lock(queue.mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+      continue;
+    }
+    auto& tasks = queue.lanes[lane];
+    if (!tasks.empty()) {
+      std::unique_ptr<CommonTask> result = std::move(tasks.back());
+      tasks.pop_back();
       return result;
     }
+  }
+  return nullptr;
+}
+
+std::unique_ptr<CommonTask> WorkerTaskRunner::PopForPool() {
+  if (terminated_.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+  for (uint32_t lane = kHighLane; lane < kLaneCount; ++lane) {
+    std::unique_ptr<CommonTask> task = PopLocal(0, static_cast<Lane>(lane));
+    if (task) {
+      pending_count_.fetch_sub(1);
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+void WorkerTaskRunner::RunTask(CommonTask* task) {
+  hippy::base::TaskTelemetry* telemetry = GetTelemetry();
+  if (!telemetry) {
+    task->Run();
+    return;
+  }
+  uint64_t start_time = telemetry->OnTaskStarted(task);
+  task->Run();
+  telemetry->OnTaskFinished(task, start_time);
+}
 
-    if (terminated_) {
+std::unique_ptr<CommonTask> WorkerTaskRunner::GetNext(uint32_t worker_index) {
+  uint32_t spin_count = 0;
+  while (true) {
+    // Queued tasks are dropped by Terminate, do not run any more of them.
+    if (terminated_.load(std::memory_order_acquire)) {
       cv_.notify_all();
       TDF_BASE_DLOG(INFO) << "WorkerTaskRunner Terminate";
       return nullptr;
     }
 
-    cv_.wait(lock);
+    if (pending_count_.load() > 0) {
+      for (uint32_t lane = kHighLane; lane < kLaneCount; ++lane) {
+        std::unique_ptr<CommonTask> task = PopLocal(worker_index, static_cast<Lane>(lane));
+        if (!task) {
+          task = Steal(worker_index, static_cast<Lane>(lane));
+        }
+        if (task) {
+          pending_count_.fetch_sub(1);
+          return task;
+        }
+      }
+      // A task is in flight or its queue was busy, try again a few times.
+      if (++spin_count < kMaxSpinCount) {
+        std::this_thread::yield();
+        continue;
+      }
+      // Then sleep until the next post, or for a moment in case the count is
+      // stale because another worker took the task.
+      spin_count = 0;
+      std::unique_lock<std::mutex> lock(mutex_);
+      sleeping_count_.fetch_add(1);
+      cv_.wait_for(lock, std::chrono::milliseconds(kSpinSleepTimeInMs));
+      sleeping_count_.fetch_sub(1);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    sleeping_count_.fetch_add(1);
+    cv_.wait(lock, [this] {
+      return pending_count_.load() > 0 || terminated_.load();
+    });
+    sleeping_count_.fetch_sub(1);
+  }
+}
+
+hippy::base::TaskTelemetry* WorkerTaskRunner::EnableTelemetry() {
+  hippy::base::TaskTelemetry* telemetry = telemetry_.load(std::memory_order_acquire);
+  if (telemetry) {
+    return telemetry;
   }
+  auto created = new hippy::base::TaskTelemetry();
+  if (!telemetry_.compare_exchange_strong(telemetry, created, std::memory_order_acq_rel)) {
+    delete created;
+    return telemetry;
+  }
+  return created;
 }
 
+hippy::base::TaskTelemetry* WorkerTaskRunner::GetTelemetry() const {
+  return telemetry_.load(std::memory_order_acquire);
+}
+
+#if defined(ENABLE_COROUTINE)
+void WorkerTaskRunner::ScheduleAwaiter::await_suspend(std::coroutine_handle<> handle) {
+  auto task = std::make_unique<CommonTask>();
+  task->source_ = "Coroutine";
+  task->func_ = [handle] { handle.resume(); };
+  runner_->PostTask(std::move(task), priority_);
+}
+#endif
+
 void WorkerTaskRunner::Terminate() {
   TDF_BASE_DLOG(INFO) << "WorkerTaskRunner::Terminate begin";
   {
@@ -74,12 +261,27 @@ void WorkerTaskRunner::Terminate() {
     terminated_ = true;
   }
   cv_.notify_all();
+  // Same for both kinds of runners, the tasks still queued are dropped here
+  // instead of delaying the join, and destroyed outside of the queue locks.
+  std::deque<std::unique_ptr<CommonTask>> dropped_tasks;
+  for (auto& queue : queues_) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    for (auto& tasks : queue->lanes) {
+      std::move(tasks.begin(), tasks.end(), std::back_inserter(dropped_tasks));
+      tasks.clear();
+    }
+  }
   thread_pool_.clear();
+  if (shared_pool_) {
+    shared_pool_->Unregister(this);
+  }
   TDF_BASE_DLOG(INFO) << "WorkerTaskRunner::Terminate end";
 }
 
-WorkerTaskRunner::WorkerThread::WorkerThread(WorkerTaskRunner* runner)
-    : Thread(Options("Hippy WorkerTaskRunner WorkerThread")), runner_(runner) {
+WorkerTaskRunner::WorkerThread::WorkerThread(WorkerTaskRunner* runner, uint32_t index)
+    : Thread(Options("Hippy WorkerTaskRunner WorkerThread")
+                 .set_scheduling_params(runner->scheduling_params_)),
+      runner_(runner), index_(index) {
   TDF_BASE_DLOG(INFO) << "WorkerThread create";
   Start();
 }
@@ -91,8 +293,10 @@ WorkerTaskRunner::WorkerThread::~WorkerThread() {
 }
 
 void WorkerTaskRunner::WorkerThread::Run() {
-  while (std::unique_ptr<CommonTask> task = runner_->GetNext()) {
-    task->Run();
+  current_worker.runner = runner_;
+  current_worker.index = index_;
+  while (std::unique_ptr<CommonTask> task = runner_->GetNext(index_)) {
+    runner_->RunTask(task.get());
   }
   TDF_BASE_DLOG(INFO) << "WorkerThread Run Terminate";
 }
@@ -95,6 +95,14 @@ namespace hippy {
     const auto it = global_base_js_source_map.find(filename);
     return it != global_base_js_source_map.cend() ? it->second : NativeSourceCode{};
   }
+  std::vector<std::string> GetNativeSourceCodeNames() {
+    std::vector<std::string> names;
+    names.reserve(global_base_js_source_map.size());
+    for (const auto& it : global_base_js_source_map) {
+      names.push_back(it.first);
+    }
+    return names;
+  }
 }  // namespace hippy
 `,
   },
@@ -103,15 +111,23 @@ namespace hippy {
 }  // namespace
 
 namespace hippy {
-  const NativeSourceCode GetNativeSourceCode(const std::string& filename) {
-    const std::unordered_map<std::string, NativeSourceCode> global_base_js_source_map{
+  static const std::unordered_map<std::string, NativeSourceCode> global_base_js_source_map{
       {"bootstrap.js", {k_bootstrap, arraysize(k_bootstrap) - 1}},  // NOLINT
       {"hippy.js", {k_hippy, arraysize(k_hippy) - 1}},  // NOLINT`,
     piece2: `
-    };
+  };
+  const NativeSourceCode GetNativeSourceCode(const std::string& filename) {
     const auto it = global_base_js_source_map.find(filename);
     return it != global_base_js_source_map.cend() ? it->second : NativeSourceCode{};
   }
+  std::vector<std::string> GetNativeSourceCodeNames() {
+    std::vector<std::string> names;
+    names.reserve(global_base_js_source_map.size());
+    for (const auto& it : global_base_js_source_map) {
+      names.push_back(it.first);
+    }
+    return names;
+  }
 }  // namespace hippy
 `,
   },